@@ -0,0 +1,165 @@
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../raftCore/include/raftPersistCodec.h"
+
+/**
+ * RaftStateCodec和原来boost text_oarchive格式的编解码耗时对比。
+ * 基线按原来的BoostPersistRaftNode实现：每条日志先SerializeAsString，整个vector<string>再交给text_oarchive；
+ * 解码时反过来，再逐条ParseFromString。
+ * 每种规模各跑若干次取最小值，之后再解码一次，检查每条日志的类型和内容都原样读回。
+ * 用法：persistCodecBench [command字节数] [重复次数]
+ */
+
+namespace
+{
+// 原来的持久化格式，只在这里作为对比基线
+class BoostPersistRaftNode
+{
+public:
+    friend class boost::serialization::access;
+    template <class Archive>
+    void serialize(Archive &ar, const unsigned int /*version*/)
+    {
+        ar &m_currentTerm;
+        ar &m_votedFor;
+        ar &m_lastSnapshotIncludeIndex;
+        ar &m_lastSnapshotIncludeTerm;
+        ar &m_logs;
+    }
+    int m_currentTerm;
+    int m_votedFor;
+    int m_lastSnapshotIncludeIndex;
+    int m_lastSnapshotIncludeTerm;
+    std::vector<std::string> m_logs;
+};
+
+std::string boostEncode(const RaftPersistHeader &header, const std::vector<raftRpcProto::LogEntry> &logs)
+{
+    BoostPersistRaftNode node;
+    node.m_currentTerm = header.currentTerm;
+    node.m_votedFor = header.votedFor;
+    node.m_lastSnapshotIncludeIndex = header.lastSnapshotIncludeIndex;
+    node.m_lastSnapshotIncludeTerm = header.lastSnapshotIncludeTerm;
+    node.m_logs.reserve(logs.size());
+    for (const auto &entry : logs)
+        node.m_logs.push_back(entry.SerializeAsString());
+
+    std::stringstream ss;
+    boost::archive::text_oarchive oa(ss);
+    oa << node;
+    return ss.str();
+}
+
+bool boostDecode(const std::string &data, RaftPersistHeader *header, std::vector<raftRpcProto::LogEntry> *logs)
+{
+    BoostPersistRaftNode node;
+    std::stringstream ss(data);
+    boost::archive::text_iarchive ia(ss);
+    ia >> node;
+    header->currentTerm = node.m_currentTerm;
+    header->votedFor = node.m_votedFor;
+    header->lastSnapshotIncludeIndex = node.m_lastSnapshotIncludeIndex;
+    header->lastSnapshotIncludeTerm = node.m_lastSnapshotIncludeTerm;
+    logs->reserve(node.m_logs.size());
+    for (const auto &item : node.m_logs)
+    {
+        logs->emplace_back();
+        if (!logs->back().ParseFromString(item))
+            return false;
+    }
+    return true;
+}
+
+// 重复repeat次，返回最短的一次耗时（毫秒）
+double bestOf(int repeat, const std::function<void()> &fn)
+{
+    double best = 1e300;
+    for (int i = 0; i < repeat; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+}
+
+int main(int argc, char **argv)
+{
+    int commandBytes = argc > 1 ? std::atoi(argv[1]) : 64;
+    int repeat = argc > 2 ? std::atoi(argv[2]) : 3;
+
+    RaftPersistHeader header{7, 2, 123, 0, 0, ""};
+    std::printf("command=%dB repeat=%d\n", commandBytes, repeat);
+    std::printf("%10s %12s %12s %12s %12s %12s %12s\n", "entries", "boost enc", "boost dec", "boost size", "codec enc",
+                "codec dec", "codec size");
+
+    for (int count : {10000, 100000, 1000000})
+    {
+        std::vector<raftRpcProto::LogEntry> logs(count);
+        for (int i = 0; i < count; i++)
+        {
+            logs[i].set_logindex(i + 1);
+            logs[i].set_logterm(1 + i / 1000);
+            // 命令内容带上下标，避免全部相同
+            std::string command(commandBytes, 'a' + i % 26);
+            logs[i].set_command(command);
+            // 夹杂少量成员变更日志，检查日志类型也被编码
+            if (i % 1000 == 999)
+                logs[i].set_type(raftRpcProto::EntryConfChange);
+        }
+
+        std::string boostData;
+        std::string codecData;
+        double boostEnc = bestOf(repeat, [&]() { boostData = boostEncode(header, logs); });
+        double codecEnc = bestOf(repeat, [&]() { codecData = RaftStateCodec::Encode(header, logs); });
+
+        bool ok = true;
+        double boostDec = bestOf(repeat,
+                                 [&]()
+                                 {
+                                     RaftPersistHeader decoded;
+                                     std::vector<raftRpcProto::LogEntry> decodedLogs;
+                                     ok = boostDecode(boostData, &decoded, &decodedLogs) &&
+                                          decodedLogs.size() == logs.size() && ok;
+                                 });
+        double codecDec = bestOf(repeat,
+                                 [&]()
+                                 {
+                                     RaftPersistHeader decoded;
+                                     std::vector<raftRpcProto::LogEntry> decodedLogs;
+                                     decodedLogs.reserve(logs.size());
+                                     ok = RaftStateCodec::Decode(codecData, &decoded, &decodedLogs) &&
+                                          decodedLogs.size() == logs.size() && ok;
+                                 });
+        {
+            RaftPersistHeader decoded;
+            std::vector<raftRpcProto::LogEntry> decodedLogs;
+            ok = RaftStateCodec::Decode(codecData, &decoded, &decodedLogs) && decoded == header &&
+                 decodedLogs.size() == logs.size() && ok;
+            for (int i = 0; ok && i < count; i++)
+            {
+                ok = decodedLogs[i].logindex() == logs[i].logindex() && decodedLogs[i].logterm() == logs[i].logterm() &&
+                     decodedLogs[i].type() == logs[i].type() && decodedLogs[i].command() == logs[i].command();
+            }
+        }
+        if (!ok)
+        {
+            std::printf("%d entries: decode failed\n", count);
+            return 1;
+        }
+        std::printf("%10d %10.1fms %10.1fms %12zu %10.1fms %10.1fms %12zu\n", count, boostEnc, boostDec, boostData.size(),
+                    codecEnc, codecDec, codecData.size());
+    }
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <vector>
+#include "../raftCore/include/raftSim.h"
+
+/**
+ * 确定性模拟基准：每个种子启动一个模拟集群，统计
+ * 1. 从启动到选出leader的虚拟时间；
+ * 2. 丢包、并且每秒隔离一次leader的情况下，提案从Start到在提出它的节点上apply的延迟分布和吞吐。
+ * 同样的参数和种子可以重放。
+ * 用法：raftSimBench [种子数] [节点数] [丢包率] [每个tick的提案数]
+ */
+
+namespace
+{
+double toMs(std::chrono::nanoseconds duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+double percentile(std::vector<double> values, double p)
+{
+    if (values.empty())
+        return 0;
+    std::sort(values.begin(), values.end());
+    size_t i = std::min(values.size() - 1, static_cast<size_t>(p * values.size()));
+    return values[i];
+}
+
+struct Proposal
+{
+    int node;
+    std::chrono::_V2::system_clock::time_point time;
+};
+}
+
+int main(int argc, char **argv)
+{
+    int seeds = argc > 1 ? std::atoi(argv[1]) : 20;
+    int nodes = argc > 2 ? std::atoi(argv[2]) : 3;
+    double dropRate = argc > 3 ? std::atof(argv[3]) : 0.01;
+    int proposalsPerTick = argc > 4 ? std::atoi(argv[4]) : 4;
+
+    const auto runTime = std::chrono::seconds(5);
+    const auto faultInterval = std::chrono::seconds(1);
+    const auto faultDuration = std::chrono::milliseconds(300);
+
+    std::vector<double> electionMs;
+    std::vector<double> commitMs;
+    long long lost = 0;
+    double virtualSeconds = 0;
+    auto realStart = std::chrono::steady_clock::now();
+
+    for (int seed = 1; seed <= seeds; seed++)
+    {
+        SimOptions options;
+        options.nodes = nodes;
+        options.seed = seed;
+        options.dropRate = dropRate;
+        SimCluster cluster(options);
+
+        auto start = cluster.Now();
+        if (!cluster.RunUntil([&]() { return cluster.Leader() != -1; }, std::chrono::seconds(30)))
+        {
+            std::printf("seed %d: no leader after 30s\n", seed);
+            continue;
+        }
+        electionMs.push_back(toMs(cluster.Now() - start));
+
+        // 提案的RequestId -> 提出它的节点和时间，在这个节点上apply时算作提交
+        std::map<int, Proposal> proposed;
+        cluster.SetApplyCallback(
+            [&](int node, const ApplyMsg &msg)
+            {
+                if (!msg.CommandValid || proposed.empty())
+                    return;
+                OperaionFromRaft op;
+                op.parseFromString(msg.Command);
+                auto it = proposed.find(op.RequestId);
+                if (it == proposed.end() || it->second.node != node)
+                    return;
+                commitMs.push_back(toMs(cluster.Now() - it->second.time));
+                proposed.erase(it);
+            });
+
+        int nextRequestId = 0;
+        auto runStart = cluster.Now();
+        auto nextFault = runStart + faultInterval;
+        auto healAt = runStart;
+        bool isolated = false;
+        cluster.RunFor(
+            runTime,
+            [&]()
+            {
+                auto nowTime = cluster.Now();
+                int leader = cluster.Leader();
+                if (!isolated && nowTime >= nextFault && leader != -1)
+                {
+                    // 隔离当前leader，其余节点要重新选举
+                    std::vector<int> others;
+                    for (int i = 0; i < nodes; i++)
+                    {
+                        if (i != leader)
+                            others.push_back(i);
+                    }
+                    cluster.Network().Partition({others});
+                    isolated = true;
+                    healAt = nowTime + faultDuration;
+                    nextFault += faultInterval;
+                }
+                if (isolated && nowTime >= healAt)
+                {
+                    cluster.Network().Heal();
+                    isolated = false;
+                }
+                if (leader == -1 || proposalsPerTick == 0)
+                    return false;
+
+                for (int k = 0; k < proposalsPerTick; k++)
+                {
+                    OperaionFromRaft op;
+                    op.Operation = "Put";
+                    op.Key = std::to_string(nextRequestId);
+                    op.Value = "v";
+                    op.ClientId = "sim";
+                    op.RequestId = nextRequestId++;
+                    int index = -1;
+                    int term = -1;
+                    bool isLeader = false;
+                    cluster.Node(leader)->Start(op, &index, &term, &isLeader);
+                    if (isLeader)
+                        proposed[op.RequestId] = Proposal{leader, nowTime};
+                }
+                return true;
+            });
+        // 被隔离的旧leader接受的提案会被新leader覆盖，永远不会在它上面apply
+        lost += proposed.size();
+        virtualSeconds += std::chrono::duration<double>(cluster.Now() - start).count();
+    }
+
+    double realSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - realStart).count();
+    std::printf("seeds=%d nodes=%d dropRate=%.3f proposalsPerTick=%d\n", seeds, nodes, dropRate, proposalsPerTick);
+    std::printf("election: p50=%.1fms p99=%.1fms max=%.1fms\n", percentile(electionMs, 0.5),
+                percentile(electionMs, 0.99), percentile(electionMs, 1.0));
+    std::printf("commit latency: p50=%.2fms p90=%.2fms p99=%.2fms (%zu commits, %lld lost)\n",
+                percentile(commitMs, 0.5), percentile(commitMs, 0.9), percentile(commitMs, 0.99), commitMs.size(),
+                lost);
+    std::printf("throughput: %.0f commits per virtual second\n",
+                commitMs.size() / std::max(1.0, static_cast<double>(seeds) * std::chrono::duration<double>(runTime).count()));
+    std::printf("simulated %.1fs in %.2fs real (%.0fx)\n", virtualSeconds, realSeconds,
+                virtualSeconds / std::max(realSeconds, 1e-9));
+    return 0;
+}
@@ -15,6 +15,52 @@ const int maxRandomizedElectionTime = 500 * debugMul;
 
 const int CONSENSUS_TIMEOUT = 500 * debugMul;
 
+// 租约读：leader在 minRandomizedElectionTime - LEASE_MAX_CLOCK_DRIFT 内收到过多数节点的回复时，
+// 直接在本地读，不再发一轮心跳确认
+const bool LEASE_READ_ENABLED = false;
+// 节点之间时钟频率偏差的上界
+const int LEASE_MAX_CLOCK_DRIFT = 50 * debugMul;
+
+// 流水线复制：每个follower最多同时在途的AppendEntries请求数和日志字节数，
+// 在途的请求在有序连接上排队依次发出，前一个的回复一到下一个立即发出，不必等待下一次心跳
+const int APPEND_INFLIGHT_MAX = 4;
+const long long APPEND_INFLIGHT_MAX_BYTES = 4LL * 1024 * 1024;
+// 每个AppendEntries请求最多携带的日志条数和Command字节数，单条日志超过字节上限时也照常发送
+// 落后很多的follower分成多个请求追赶，避免一个巨大的请求占满两边的内存和连接
+const int APPEND_MAX_ENTRIES = 512;
+const long long APPEND_MAX_BYTES = 1024LL * 1024;
+// 每个对端节点的rpc连接数，MpRpcChannel是同步收发的，并发请求需要各自占用一条连接。
+// 一条有序连接给AppendEntries，其余给投票、快照、ReadIndex等请求
+const int RPC_CONNECTIONS_PER_PEER = 3;
+
+// 提案攒批：距上一批超过PROPOSAL_BATCH_WINDOW_US时新提案立即发送（低负载不增加延迟），
+// 否则在这个窗口内攒批，或者攒够条数、字节数上限后一起落盘并发给follower
+const int PROPOSAL_BATCH_WINDOW_US = 200;
+const int PROPOSAL_BATCH_MAX_COUNT = 256;
+const long long PROPOSAL_BATCH_MAX_BYTES = 1024LL * 1024;
+
+// WAL单个段文件的大小上限，超过后滚动到新的段文件
+const long long WAL_SEGMENT_MAX_BYTES = 64LL * 1024 * 1024;
+// 组提交：攒够这么多次日志追加就立即fsync
+const int PERSIST_BATCH_SIZE = 64;
+// 组提交：最早的一次未落盘追加最多等待这么久（微秒）就fsync
+const int PERSIST_MAX_DELAY_US = 1000;
+
+// 快照分块发送时每块的大小
+const long long SNAPSHOT_CHUNK_BYTES = 1024LL * 1024;
+// 快照保存和发送时使用的压缩算法：0不压缩，1 LZ4，2 zstd（见raftCore/include/snapshotCodec.h）
+// 没有编译进来的算法（缺少lz4.h或zstd.h）退回不压缩，启动时在标准错误上提示；读取时按快照头部自动识别
+const int SNAPSHOT_COMPRESSION = 1;
+
+// Multi-Raft共享定时线程的tick间隔（毫秒），各组的心跳、选举超时都以它为最小粒度
+const int MULTI_RAFT_TICK_MS = 1;
+
+// learner落后leader最后一条日志不超过这么多条时才能提升为voter，避免提升后拖慢提交
+const int LEARNER_CATCHUP_MAX_LAG = 100;
+
+// witness没有状态机，也不会收到上层的Snapshot调用，已执行的日志超过这么多条时自己压缩
+const int WITNESS_LOG_COMPACT_ENTRIES = 10000;
+
 // 协程库中线程池大小
 const int FIBER_THREAD_NUM = 1;
 // 是否使用caller_threaִd执行调度任务
@@ -9,6 +9,7 @@
 #include <boost/serialization/access.hpp>
 #include <sstream>
 #include <functional>
+#include <memory>
 #include <random>
 #include <iostream>
 #include <thread>
@@ -82,13 +83,69 @@ std::string format(const char* format_str, Args... args) {
     return ss.str();
 }
 
+/**
+ * 时钟：默认是系统时钟。确定性模拟时换成由模拟器推进的虚拟时钟，
+ * raft中所有超时判断都通过now()，所有定时睡眠都通过sleepFor()，所有条件变量等待都通过waitCond()/waitUntil()/waitFor()，
+ * 发rpc等一次性的后台任务都通过runAsync()启动
+ */
+class Clock {
+public:
+    virtual ~Clock() = default;
+    virtual std::chrono::_V2::system_clock::time_point Now() = 0;
+    virtual void SleepFor(std::chrono::microseconds duration) = 0;
+    // 在cond上等待，最晚在这个时钟到达deadline时返回；和condition_variable一样可能提前醒来
+    virtual void WaitUntil(std::condition_variable &cond, std::unique_lock<std::mutex> &lock,
+                           std::chrono::_V2::system_clock::time_point deadline) = 0;
+    // 不带超时地在cond上等待。模拟器需要知道哪些线程还在运行，全部停下等待时才能推进虚拟时间
+    virtual void Wait(std::condition_variable &cond, std::unique_lock<std::mutex> &lock) = 0;
+    virtual void Spawn(std::function<void()> task) = 0;
+};
+// 在创建Raft之前调用，nullptr恢复系统时钟
+void setClock(std::shared_ptr<Clock> clock);
+// 设置之后随机选举超时由这个种子决定，同一个种子的模拟可以重放
+void setRandomSeed(unsigned seed);
+
 // 获取当前时间
 std::chrono::_V2::system_clock::time_point now();
 // 获取随机选举超时时间
 std::chrono::milliseconds getRandomizedElectionTimeout();
 
+void sleepFor(std::chrono::microseconds duration);
 void sleepNMilliseconds(int N);
 
+void waitCond(std::condition_variable &cond, std::unique_lock<std::mutex> &lock);
+template <typename Predicate>
+void waitCond(std::condition_variable &cond, std::unique_lock<std::mutex> &lock, Predicate pred)
+{
+    while (!pred())
+        waitCond(cond, lock);
+}
+void waitUntil(std::condition_variable &cond, std::unique_lock<std::mutex> &lock,
+               std::chrono::_V2::system_clock::time_point deadline);
+// 等到pred成立或者超时，返回pred的值
+template <typename Predicate>
+bool waitUntil(std::condition_variable &cond, std::unique_lock<std::mutex> &lock,
+               std::chrono::_V2::system_clock::time_point deadline, Predicate pred)
+{
+    while (!pred())
+    {
+        if (now() >= deadline)
+            return pred();
+        waitUntil(cond, lock, deadline);
+    }
+    return true;
+}
+template <typename Predicate>
+bool waitFor(std::condition_variable &cond, std::unique_lock<std::mutex> &lock, std::chrono::microseconds duration,
+             Predicate pred)
+{
+    return waitUntil(cond, lock, now() + duration, std::move(pred));
+}
+void waitFor(std::condition_variable &cond, std::unique_lock<std::mutex> &lock, std::chrono::microseconds duration);
+
+// 启动一个后台任务，默认是一个detach的线程，任务自己保证用到的对象活得足够久
+void runAsync(std::function<void()> task);
+
 // 异步写日志的日志队列
 // lock_guard 和 unique_lock 的区别
 template <typename T>
@@ -107,10 +164,8 @@ public:
     // 线程读日志
     T Pop() {
         std::unique_lock<std::mutex> lock(m_mutex);
-        while (m_queue.empty()) {
-            // 日志队列为空，线程阻塞
-            m_convariable.wait(lock);
-        }
+        // 日志队列为空，线程阻塞
+        waitCond(m_convariable, lock, [&]() { return !m_queue.empty(); });
         T data = m_queue.front();
         m_queue.pop();
         return data;
@@ -120,17 +175,9 @@ public:
     bool timeOutPop(int timeout, T* ResData) {
         std::unique_lock<std::mutex> lock(m_mutex);
 
-        // 获取当前时间，并计算超时时间
-        auto now = std::chrono::system_clock::now();
-        auto timeout_time = now + std::chrono::milliseconds(timeout);
-
-        // 超时之前不断检查队列是否为空
-        while (m_queue.empty()) {
-            // 如果超时，返回一个空对象
-            if (m_convariable.wait_until(lock, timeout_time) == std::cv_status::timeout)
-                return false;
-            else continue;
-        }
+        // 超时之前不断检查队列是否为空，超时按Clock计算
+        if (!waitFor(m_convariable, lock, std::chrono::milliseconds(timeout), [&]() { return !m_queue.empty(); }))
+            return false;
 
         T data = m_queue.front();
         m_queue.pop();
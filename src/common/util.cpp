@@ -1,5 +1,6 @@
 #include "include/util.h"
 #include "include/config.h"
+#include <atomic>
 #include <chrono>
 #include <cstdarg>
 #include <cstdio>
@@ -17,23 +18,105 @@ void myAssert(bool condition, std::string message)
     }
 }
 
+namespace
+{
+// setClock持有所有权，now()只读裸指针，不在热路径上操作引用计数
+std::shared_ptr<Clock> g_clockOwner;
+std::atomic<Clock *> g_clock{nullptr};
+
+std::mutex g_rngMtx;
+bool g_rngSeeded = false;
+std::mt19937 g_rng;
+}
+
+void setClock(std::shared_ptr<Clock> clock)
+{
+    g_clock = clock.get();
+    g_clockOwner = std::move(clock);
+}
+
+void setRandomSeed(unsigned seed)
+{
+    std::lock_guard<std::mutex> lg(g_rngMtx);
+    g_rng.seed(seed);
+    g_rngSeeded = true;
+}
+
 std::chrono::_V2::system_clock::time_point now()
 {
+    Clock *clock = g_clock;
+    if (clock != nullptr)
+        return clock->Now();
     return std::chrono::high_resolution_clock::now();
 }
 
 std::chrono::milliseconds getRandomizedElectionTimeout()
 {
-    std::random_device rd;
-    std::mt19937 rng(rd());
     std::uniform_int_distribution<int> dist(minRandomizedElectionTime, maxRandomizedElectionTime);
+    std::lock_guard<std::mutex> lg(g_rngMtx);
+    if (!g_rngSeeded)
+    {
+        std::random_device rd;
+        g_rng.seed(rd());
+        g_rngSeeded = true;
+    }
+    return std::chrono::milliseconds(dist(g_rng));
+}
 
-    return std::chrono::milliseconds(dist(rng));
+void sleepFor(std::chrono::microseconds duration)
+{
+    Clock *clock = g_clock;
+    if (clock != nullptr)
+    {
+        clock->SleepFor(duration);
+        return;
+    }
+    std::this_thread::sleep_for(duration);
 }
 
 void sleepNMilliseconds(int N)
 {
-    std::this_thread::sleep_for(std::chrono::milliseconds(N));
+    sleepFor(std::chrono::milliseconds(N));
+}
+
+void waitCond(std::condition_variable &cond, std::unique_lock<std::mutex> &lock)
+{
+    Clock *clock = g_clock;
+    if (clock != nullptr)
+    {
+        clock->Wait(cond, lock);
+        return;
+    }
+    cond.wait(lock);
+}
+
+void waitUntil(std::condition_variable &cond, std::unique_lock<std::mutex> &lock,
+               std::chrono::_V2::system_clock::time_point deadline)
+{
+    Clock *clock = g_clock;
+    if (clock != nullptr)
+    {
+        clock->WaitUntil(cond, lock, deadline);
+        return;
+    }
+    cond.wait_until(lock, deadline);
+}
+
+void waitFor(std::condition_variable &cond, std::unique_lock<std::mutex> &lock, std::chrono::microseconds duration)
+{
+    waitUntil(cond, lock, now() + duration);
+}
+
+void runAsync(std::function<void()> task)
+{
+    Clock *clock = g_clock;
+    if (clock != nullptr)
+    {
+        clock->Spawn(std::move(task));
+        return;
+    }
+    std::thread t(std::move(task));
+    t.detach();
 }
 
 bool isReleasePort(unsigned short usPort)
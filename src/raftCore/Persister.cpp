@@ -1,43 +1,179 @@
 #include "include/Persister.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
 #include "../common/include/util.h"
 
+namespace
+{
+    /**
+     * 先写临时文件并fdatasync，再rename覆盖原文件，最后fsync所在目录让rename本身落盘。
+     * 崩溃后文件要么是旧内容要么是新内容，不会只写了一半
+     */
+    void writeFileDurable(const std::string &path, const std::string &data)
+    {
+        std::string tmpPath = path + ".tmp";
+        int fd = ::open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        myAssert(fd != -1, format("[func-writeFileDurable] open %s failed, errno:%d", tmpPath, errno));
+        size_t written = 0;
+        while (written < data.size())
+        {
+            ssize_t n = ::write(fd, data.data() + written, data.size() - written);
+            if (n == -1 && errno == EINTR)
+                continue;
+            myAssert(n > 0, format("[func-writeFileDurable] write %s failed, errno:%d", tmpPath, errno));
+            written += n;
+        }
+        myAssert(::fdatasync(fd) == 0, format("[func-writeFileDurable] fdatasync %s failed, errno:%d", tmpPath, errno));
+        ::close(fd);
+        myAssert(::rename(tmpPath.c_str(), path.c_str()) == 0,
+                 format("[func-writeFileDurable] rename %s failed, errno:%d", tmpPath, errno));
+
+        size_t slash = path.rfind('/');
+        std::string dir = slash == std::string::npos ? "." : path.substr(0, slash);
+        int dirFd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+        myAssert(dirFd != -1, format("[func-writeFileDurable] open %s failed, errno:%d", dir, errno));
+        myAssert(::fsync(dirFd) == 0, format("[func-writeFileDurable] fsync %s failed, errno:%d", dir, errno));
+        ::close(dirFd);
+    }
+}
+
 void Persister::Save(const std::string raftstate, const std::string snapshot)
 {
     std::lock_guard<std::mutex> lg(m_mtx);
-    clearRaftStateAndSnapshot();
-    // 将raftstate和snapshot写入本地文件
-    m_raftStateOutStream << raftstate;
-    m_snapshotOutStream << snapshot;
+    if (m_inMemory)
+    {
+        m_snapshot = SnapshotCodec::Encode(snapshot, SNAPSHOT_COMPRESSION);
+        m_raftState = raftstate;
+        m_raftStateSize = raftstate.size();
+        return;
+    }
+    // raftState中记录了快照的位置，先让快照落盘，崩溃时不会出现raftState指向一个不存在的快照
+    writeFileDurable(m_snapshotFileName, SnapshotCodec::Encode(snapshot, SNAPSHOT_COMPRESSION));
+    writeFileDurable(m_raftStateFileName, raftstate);
+    m_raftStateSize = raftstate.size();
 }
 
 std::string Persister::ReadSnapshot()
 {
     std::lock_guard<std::mutex> lg(m_mtx);
-    if (m_snapshotOutStream.is_open())
-        m_snapshotOutStream.close();
-
-    DEFER
+    std::string data;
+    if (m_inMemory)
     {
-        // 默认是追加
-        m_snapshotOutStream.open(m_snapshotFileName);
-    };
-    std::fstream ifs(m_snapshotFileName, std::ios_base::in);
+        if (m_snapshot.empty())
+            return "";
+        data = m_snapshot;
+    }
+    else
+    {
+        std::ifstream ifs(m_snapshotFileName, std::ios_base::in | std::ios_base::binary);
+        if (!ifs.good())
+            return "";
+
+        // 内容是二进制的，必须整个文件读出来，不能用>>按空白分割
+        data.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        ifs.close();
+    }
+    std::string snapshot;
+    myAssert(SnapshotCodec::Decode(data, &snapshot),
+             format("[func-Persister::ReadSnapshot] decode %s failed", m_snapshotFileName));
+    return snapshot;
+}
+
+long long Persister::SnapshotSize()
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (m_inMemory)
+        return m_snapshot.size();
+    std::ifstream ifs(m_snapshotFileName, std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
+    if (!ifs.good())
+        return 0;
+    return static_cast<long long>(ifs.tellg());
+}
+
+std::string Persister::ReadSnapshotChunk(long long offset, long long length)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (m_inMemory)
+        return offset < static_cast<long long>(m_snapshot.size()) ? m_snapshot.substr(offset, length) : "";
+    std::ifstream ifs(m_snapshotFileName, std::ios_base::in | std::ios_base::binary);
     if (!ifs.good())
         return "";
-    
+
+    ifs.seekg(offset);
+    std::string chunk(length, '\0');
+    ifs.read(&chunk[0], length);
+    chunk.resize(ifs.gcount());
+    return chunk;
+}
+
+void Persister::BeginReceivedSnapshot()
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (m_inMemory)
+    {
+        m_receivedSnapshot.clear();
+        return;
+    }
+    if (m_receivedSnapshotOutStream.is_open())
+        m_receivedSnapshotOutStream.close();
+    m_receivedSnapshotOutStream.open(m_receivedSnapshotFileName, std::ios::out | std::ios::trunc | std::ios::binary);
+}
+
+void Persister::AppendReceivedSnapshot(const std::string &chunk)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (m_inMemory)
+    {
+        m_receivedSnapshot += chunk;
+        return;
+    }
+    m_receivedSnapshotOutStream.write(chunk.data(), chunk.size());
+    myAssert(m_receivedSnapshotOutStream.good(),
+             format("[func-Persister::AppendReceivedSnapshot] write %s failed", m_receivedSnapshotFileName));
+}
+
+std::string Persister::ReadReceivedSnapshot()
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    std::string data;
+    if (m_inMemory)
+    {
+        if (m_receivedSnapshot.empty())
+            return "";
+        data.swap(m_receivedSnapshot);
+    }
+    else
+    {
+        if (m_receivedSnapshotOutStream.is_open())
+            m_receivedSnapshotOutStream.close();
+        std::ifstream ifs(m_receivedSnapshotFileName, std::ios_base::in | std::ios_base::binary);
+        if (!ifs.good())
+            return "";
+
+        data.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        ifs.close();
+        // 已经读进内存，临时文件不再需要
+        std::remove(m_receivedSnapshotFileName.c_str());
+    }
     std::string snapshot;
-    ifs >> snapshot;
-    ifs.close();
+    if (!SnapshotCodec::Decode(data, &snapshot))
+    {
+        DPrintf("[func-Persister::ReadReceivedSnapshot] 收到的快照解码失败");
+        return "";
+    }
     return snapshot;
 }
 
 void Persister::SaveRaftState(const std::string &data)
 {
     std::lock_guard<std::mutex> lg(m_mtx);
-    // 将raftstate和snapshot写入本地文件
-    clearRaftState();
-    m_raftStateOutStream << data;
-    m_raftStateSize += data.size();
+    if (m_inMemory)
+        m_raftState = data;
+    else
+        writeFileDurable(m_raftStateFileName, data);
+    m_raftStateSize = data.size();
 }
 
 long long Persister::RaftStateSize()
@@ -49,22 +185,169 @@ long long Persister::RaftStateSize()
 std::string Persister::ReadRaftState()
 {
     std::lock_guard<std::mutex> lg(m_mtx);
-
-    std::fstream ifs(m_raftStateFileName, std::ios_base::in);
+    if (m_inMemory)
+        return m_raftState;
+    std::ifstream ifs(m_raftStateFileName, std::ios_base::in | std::ios_base::binary);
     if (!ifs.good())
         return "";
-    
-    std::string snapshot;
-    ifs >> snapshot;
+
+    std::string raftState((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
     ifs.close();
-    return snapshot;
+    return raftState;
 }
 
-Persister::Persister(const int me)
-    : m_raftStateFileName("raftstatePersist" + std::to_string(me) + ".txt"),
-      m_snapshotFileName("snapshotPersist" + std::to_string(me) + ".txt"),
-      m_raftStateSize(0)
+uint64_t Persister::AppendLog(const std::vector<raftRpcProto::LogEntry> &entries)
 {
+    std::lock_guard<std::mutex> lg(m_mtx);
+    std::lock_guard<std::mutex> syncLock(m_syncMtx);
+    // 心跳没有新日志，只需要等待之前的追加落盘
+    if (entries.empty())
+        return m_appendedSeq;
+
+    if (m_inMemory)
+    {
+        for (const auto &entry : entries)
+        {
+            m_memLog.push_back(entry);
+            m_memLogBytes += RaftWal::RecordSize(entry);
+        }
+    }
+    else
+    {
+        m_wal->Append(entries);
+    }
+    // 内存模式也按序号走落盘线程，模拟的落盘耗时和攒批与文件模式一致
+    ++m_appendedSeq;
+    m_syncer->Notify(this);
+    return m_appendedSeq;
+}
+
+uint64_t Persister::LastAppendTicket()
+{
+    std::lock_guard<std::mutex> lock(m_syncMtx);
+    return m_appendedSeq;
+}
+
+void Persister::WaitDurable(uint64_t ticket)
+{
+    std::unique_lock<std::mutex> lock(m_syncMtx);
+    waitCond(m_syncCond, lock, [&]() { return m_durableSeq >= ticket || m_stopSync; });
+}
+
+void Persister::OnDurable(uint64_t ticket, std::function<void()> cb)
+{
+    std::lock_guard<std::mutex> lock(m_syncMtx);
+    m_durableCallbacks.emplace(ticket, std::move(cb));
+    // 已经落盘，立即唤醒落盘线程执行回调，不等攒批
+    if (m_durableSeq >= ticket)
+        m_syncer->Notify(this, true);
+}
+
+void Persister::syncOnce(bool fsync)
+{
+    uint64_t target;
+    bool needSync;
+    {
+        std::lock_guard<std::mutex> lock(m_syncMtx);
+        target = m_appendedSeq;
+        needSync = target != m_durableSeq;
+    }
+
+    // AppendLog先写WAL再递增序号，所以target之前的数据都已经在活跃段或已落盘的旧段里
+    // 没有新的追加时只执行已经落盘的序号上的回调
+    if (needSync && fsync && !m_inMemory)
+    {
+        int fd;
+        {
+            std::lock_guard<std::mutex> lg(m_mtx);
+            fd = m_wal->DupActiveFd();
+        }
+        myAssert(::fdatasync(fd) == 0, format("[func-Persister::syncOnce] fdatasync failed, errno:%d", errno));
+        ::close(fd);
+    }
+
+    std::vector<std::function<void()>> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(m_syncMtx);
+        m_durableSeq = std::max(m_durableSeq, target);
+        auto end = m_durableCallbacks.upper_bound(m_durableSeq);
+        for (auto it = m_durableCallbacks.begin(); it != end; ++it)
+            callbacks.push_back(std::move(it->second));
+        m_durableCallbacks.erase(m_durableCallbacks.begin(), end);
+        m_syncCond.notify_all();
+    }
+    for (auto &cb : callbacks)
+        cb();
+}
+
+void Persister::TruncateLog(int fromIndex)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (!m_inMemory)
+    {
+        m_wal->TruncateSuffix(fromIndex);
+        return;
+    }
+    while (!m_memLog.empty() && m_memLog.back().logindex() >= fromIndex)
+    {
+        m_memLogBytes -= RaftWal::RecordSize(m_memLog.back());
+        m_memLog.pop_back();
+    }
+}
+
+void Persister::CompactLog(int lastIncludedIndex)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (!m_inMemory)
+    {
+        m_wal->CompactTo(lastIncludedIndex);
+        return;
+    }
+    // 内存中没有段的划分，被快照覆盖的日志直接删除
+    auto end = m_memLog.begin();
+    while (end != m_memLog.end() && end->logindex() <= lastIncludedIndex)
+    {
+        m_memLogBytes -= RaftWal::RecordSize(*end);
+        ++end;
+    }
+    m_memLog.erase(m_memLog.begin(), end);
+}
+
+std::vector<raftRpcProto::LogEntry> Persister::ReadLog()
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (m_inMemory)
+        return m_memLog;
+    return m_wal->ReadAll();
+}
+
+long long Persister::LogSize()
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (m_inMemory)
+        return m_memLogBytes;
+    return m_wal->SizeBytes();
+}
+
+Persister::Persister(const int me) : Persister(std::to_string(me), std::make_shared<PersistSyncer>()) {}
+
+Persister::Persister(const std::string &name, std::shared_ptr<PersistSyncer> syncer, bool inMemory)
+    : m_inMemory(inMemory),
+      m_raftStateFileName("raftstatePersist" + name + ".txt"),
+      m_snapshotFileName("snapshotPersist" + name + ".txt"),
+      m_receivedSnapshotFileName("snapshotReceiving" + name + ".txt"),
+      m_raftStateSize(0),
+      m_wal(inMemory ? nullptr : std::make_unique<RaftWal>("raftWal" + name)),
+      m_memLogBytes(0),
+      m_syncer(std::move(syncer)),
+      m_stopSync(false),
+      m_appendedSeq(0),
+      m_durableSeq(0)
+{
+    SnapshotCodec::WarnIfUnsupported(SNAPSHOT_COMPRESSION);
+    if (m_inMemory)
+        return;
+
     // 检查文件状态并清空
     bool fileOpenFlag = true;
     std::fstream file(m_raftStateFileName, std::ios::out | std::ios::trunc);
@@ -83,8 +366,17 @@ Persister::Persister(const int me)
     
     if (!fileOpenFlag)
         DPrintf("[func-Persister::Persister] file open error");
-    
-    // 绑定流
-    m_raftStateOutStream.open(m_raftStateFileName);
-    m_snapshotOutStream.open(m_snapshotFileName);
+
+    // 和raftState、snapshot文件保持一致，启动时清空WAL
+    m_wal->Reset();
+}
+
+Persister::~Persister()
+{
+    m_syncer->Remove(this);
+    {
+        std::lock_guard<std::mutex> lock(m_syncMtx);
+        m_stopSync = true;
+        m_syncCond.notify_all();
+    }
 }
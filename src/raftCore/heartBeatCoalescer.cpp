@@ -0,0 +1,102 @@
+#include "include/heartBeatCoalescer.h"
+#include "../common/include/util.h"
+
+HeartBeatCoalescer::HeartBeatCoalescer(std::vector<std::shared_ptr<RaftRpcUtil>> peers)
+    : m_peers(std::move(peers)), m_pending(m_peers.size()), m_ready(m_peers.size()), m_stop(false)
+{
+    for (int server = 0; server < static_cast<int>(m_peers.size()); server++)
+    {
+        if (m_peers[server] != nullptr)
+            m_threads.emplace_back(&HeartBeatCoalescer::sendLoop, this, server);
+    }
+}
+
+HeartBeatCoalescer::~HeartBeatCoalescer()
+{
+    Stop();
+}
+
+void HeartBeatCoalescer::Add(int server, std::shared_ptr<raftRpcProto::AppendEntriesArgs> args,
+                             std::shared_ptr<raftRpcProto::AppendEntriesReply> reply, Callback cb)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_pending[server].push_back(Pending{std::move(args), std::move(reply), std::move(cb)});
+}
+
+void HeartBeatCoalescer::Flush()
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    for (int server = 0; server < static_cast<int>(m_pending.size()); server++)
+    {
+        auto &pending = m_pending[server];
+        if (pending.empty())
+            continue;
+        auto &ready = m_ready[server];
+        ready.insert(ready.end(), std::make_move_iterator(pending.begin()), std::make_move_iterator(pending.end()));
+        pending.clear();
+    }
+    m_cond.notify_all();
+}
+
+void HeartBeatCoalescer::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        if (m_stop)
+            return;
+        m_stop = true;
+        m_cond.notify_all();
+    }
+    for (auto &t : m_threads)
+        t.join();
+
+    std::vector<Pending> dropped;
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        for (auto *queues : {&m_pending, &m_ready})
+        {
+            for (auto &queue : *queues)
+            {
+                for (auto &pending : queue)
+                    dropped.push_back(std::move(pending));
+                queue.clear();
+            }
+        }
+    }
+    // 回调会拿raft组的锁，不能持有m_mtx执行
+    for (auto &pending : dropped)
+        pending.cb(false);
+}
+
+void HeartBeatCoalescer::sendLoop(int server)
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    while (true)
+    {
+        waitCond(m_cond, lock, [&]() { return m_stop || !m_ready[server].empty(); });
+        if (m_stop)
+            return;
+        std::vector<Pending> batch;
+        batch.swap(m_ready[server]);
+        lock.unlock();
+        send(server, std::move(batch));
+        lock.lock();
+    }
+}
+
+void HeartBeatCoalescer::send(int server, std::vector<Pending> batch)
+{
+    raftRpcProto::BatchAppendEntriesArgs args;
+    raftRpcProto::BatchAppendEntriesReply reply;
+    for (auto &pending : batch)
+        *args.add_args() = *pending.args;
+
+    bool ok = m_peers[server]->BatchAppendEntries(&args, &reply) &&
+              reply.replies_size() == static_cast<int>(batch.size());
+    for (int i = 0; i < static_cast<int>(batch.size()); i++)
+    {
+        if (ok)
+            *batch[i].reply = reply.replies(i);
+        batch[i].cb(ok);
+    }
+}
@@ -2,6 +2,7 @@
 #define APPLYMSG_H
 #include <string>
 
+// 成员变更日志也会推进CommandIndex，但CommandValid为false，上层状态机不需要执行
 class ApplyMsg {
 public:
     bool CommandValid;
@@ -1,38 +1,104 @@
 #ifndef SKIP_LIST_ON_RAFT_PERSISTER_H
 #define SKIP_LIST_ON_RAFT_PERSISTER_H
 
+#include <chrono>
+#include <condition_variable>
 #include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <vector>
+#include "persistSyncer.h"
+#include "raftWal.h"
+#include "snapshotCodec.h"
 
 class Persister {
 private:
     std::mutex m_mtx;
+    // 内存模式（确定性模拟用）：raftState、快照和日志都只保存在内存中，不读写文件，也不fdatasync
+    const bool m_inMemory;
+    // 内存模式下的raftState和压缩后的快照，快照和文件模式下的文件内容相同
     std::string m_raftState;
     std::string m_snapshot;
+    // 内存模式下正在分块接收的快照
+    std::string m_receivedSnapshot;
 
     const std::string m_raftStateFileName;
     const std::string m_snapshotFileName;
+    // 正在分块接收的快照先写入这个临时文件，全部收到后才安装
+    const std::string m_receivedSnapshotFileName;
 
-    // 保存raftState的输出流
-    std::ofstream m_raftStateOutStream;
-
-    // 保存snapshot的输出流
-    std::ofstream m_snapshotOutStream;
+    // 正在接收的快照的输出流
+    std::ofstream m_receivedSnapshotOutStream;
 
     // 保存raftStateSize的大小
     long long m_raftStateSize;
 
-    void clearRaftState();
-    void clearSnapshot();
-    void clearRaftStateAndSnapshot();
+    // 日志条目单独追加写入分段WAL，不再跟随raftState整体重写；内存模式下为空
+    std::unique_ptr<RaftWal> m_wal;
+    // 内存模式下的日志，以及它们按WAL记录格式计算的字节数
+    std::vector<raftRpcProto::LogEntry> m_memLog;
+    long long m_memLogBytes;
+
+    /**
+     * 组提交：AppendLog只把日志写进page cache并领取一个递增的序号，
+     * 由PersistSyncer的落盘线程攒批后统一fsync一次，再唤醒等待这些序号的调用者。
+     * 这样fsync不会发生在Raft::m_mtx之内，多个Start()和AppendEntries共享一次fsync
+     */
+    std::mutex m_syncMtx;
+    std::condition_variable m_syncCond;
+    std::shared_ptr<PersistSyncer> m_syncer;
+    bool m_stopSync;
+    // 已写入WAL的最大序号
+    uint64_t m_appendedSeq;
+    // 已落盘的最大序号
+    uint64_t m_durableSeq;
+    // 等待某个序号落盘的回调
+    std::multimap<uint64_t, std::function<void()>> m_durableCallbacks;
+
+    friend class PersistSyncer;
+    // 由落盘线程调用：fdatasync一次（fsync为false时跳过，用于模拟），推进m_durableSeq并执行回调
+    void syncOnce(bool fsync);
 
 public:
+    // 快照按SNAPSHOT_COMPRESSION压缩后写入文件，ReadSnapshot时自动解压
+    // 先写快照再写raftState，返回时两者都已经落盘
     void Save(std::string raftstate, std::string snapshot);
     std::string ReadSnapshot();
+    // 分块发送快照：按偏移读取快照文件的一部分，不需要把整个快照读进内存
+    // 读到的是压缩后的文件内容，接收方原样写入临时文件
+    long long SnapshotSize();
+    std::string ReadSnapshotChunk(long long offset, long long length);
+    // 分块接收快照：清空临时文件，按顺序追加收到的块，全部收到后读出
+    void BeginReceivedSnapshot();
+    void AppendReceivedSnapshot(const std::string &chunk);
+    std::string ReadReceivedSnapshot();
+    // 返回时raftState已经落盘，调用方可以在这之后回复投票等依赖它的请求
     void SaveRaftState(const std::string &data);
     long long RaftStateSize();
     std::string ReadRaftState();
+
+    // 只追加新的日志条目，返回本次追加的序号，落盘之前不保证持久化
+    uint64_t AppendLog(const std::vector<raftRpcProto::LogEntry> &entries);
+    // 最近一次追加的序号，等待它落盘就等于等待目前为止所有的追加落盘
+    uint64_t LastAppendTicket();
+    // 阻塞直到序号ticket及之前的追加全部落盘
+    void WaitDurable(uint64_t ticket);
+    // 序号ticket落盘后在落盘线程中执行cb；已经落盘时也交给落盘线程执行，不在调用方线程中执行，
+    // 调用方可以持有cb里要加的锁（比如Raft::m_mtx）
+    void OnDurable(uint64_t ticket, std::function<void()> cb);
+    // 删除logIndex >= fromIndex的日志
+    void TruncateLog(int fromIndex);
+    // 快照之后删除被快照完全覆盖的日志段
+    void CompactLog(int lastIncludedIndex);
+    std::vector<raftRpcProto::LogEntry> ReadLog();
+    long long LogSize();
     explicit Persister(int me);
+    // Multi-Raft：name区分同一进程中不同raft组的文件，syncer由所有组共享
+    // inMemory为true时不创建任何文件，重启后状态不保留，只用于确定性模拟
+    Persister(const std::string &name, std::shared_ptr<PersistSyncer> syncer, bool inMemory = false);
     ~Persister();
 };
 
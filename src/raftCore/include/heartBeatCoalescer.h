@@ -0,0 +1,60 @@
+#ifndef HEARTBEATCOALESCER_H
+#define HEARTBEATCOALESCER_H
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "raftRpcUtil.h"
+
+/**
+ * Multi-Raft的心跳合并：各raft组发往同一个节点的心跳（不带日志的AppendEntries）先放在这里，
+ * 由MultiRaft的定时线程每个tick调用一次Flush，每个目标节点只发一个BatchAppendEntries。
+ * 上千个组时，心跳的rpc数和线程数从 组数*节点数 降到 节点数
+ */
+class HeartBeatCoalescer {
+public:
+    // ok为false表示rpc失败，reply无效
+    using Callback = std::function<void(bool ok)>;
+
+    // 每个对端节点一个发送线程，由这个对象持有，析构时join
+    explicit HeartBeatCoalescer(std::vector<std::shared_ptr<RaftRpcUtil>> peers);
+    ~HeartBeatCoalescer();
+
+    void Add(int server, std::shared_ptr<raftRpcProto::AppendEntriesArgs> args,
+             std::shared_ptr<raftRpcProto::AppendEntriesReply> reply, Callback cb);
+    // 是否有到server的连接，raft组通过成员变更加入的节点不在这里，心跳单独发送
+    bool Has(int server) const { return server < static_cast<int>(m_peers.size()) && m_peers[server] != nullptr; }
+    // 把攒下的心跳交给各目标节点的发送线程，不阻塞调用者；
+    // 上一批还没发完时，这一批和之后攒下的心跳合并成下一个rpc
+    void Flush();
+    // 停止并join发送线程，还没发出的心跳以失败回调；回调中用到的raft组要在这之后才能销毁
+    void Stop();
+
+private:
+    struct Pending
+    {
+        std::shared_ptr<raftRpcProto::AppendEntriesArgs> args;
+        std::shared_ptr<raftRpcProto::AppendEntriesReply> reply;
+        Callback cb;
+    };
+
+    std::vector<std::shared_ptr<RaftRpcUtil>> m_peers;
+    std::mutex m_mtx;
+    // 有心跳可以发送或者要停止时通知发送线程
+    std::condition_variable m_cond;
+    // 每个目标节点在这个tick攒下的心跳
+    std::vector<std::vector<Pending>> m_pending;
+    // 每个目标节点已经Flush、等待发送线程发出的心跳
+    std::vector<std::vector<Pending>> m_ready;
+    std::vector<std::thread> m_threads;
+    bool m_stop;
+
+    // 发送线程：取出m_ready[server]中的心跳合并成一个rpc发出
+    void sendLoop(int server);
+    void send(int server, std::vector<Pending> batch);
+};
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef MULTIRAFT_H
+#define MULTIRAFT_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "heartBeatCoalescer.h"
+#include "persistSyncer.h"
+#include "raft.h"
+
+/**
+ * Multi-Raft：一个进程中运行多个raft组，每个组负责一部分key
+ * 所有组共享：
+ * 1. 到每个节点的rpc连接（m_peers），请求中带GroupId，由这里的rpc方法分发给对应的组；
+ * 2. 一个定时线程，每MULTI_RAFT_TICK_MS调用一次各组的tick()，代替每组自己的定时器、applier和攒批线程；
+ * 3. 心跳合并：同一个tick内各组发往同一节点的心跳合成一个BatchAppendEntries；
+ * 4. 一个PersistSyncer落盘线程，各组的WAL追加攒进同一批fsync。
+ * 各节点上同一个groupId的raft组组成一个raft集群。
+ * 删除组时先停止分发，再等这个组已经发出的rpc任务结束，之后它的Raft对象随最后一个引用释放
+ */
+class MultiRaft : public raftRpcProto::raftRpc {
+public:
+    MultiRaft(int me, std::vector<std::shared_ptr<RaftRpcUtil>> peers);
+    ~MultiRaft();
+
+    // 创建并注册一个raft组，已经存在时返回已有的组
+    std::shared_ptr<Raft> AddGroup(int groupId, std::shared_ptr<LockQueue<ApplyMsg>> applyCh);
+    // 不存在时返回nullptr
+    std::shared_ptr<Raft> GetGroup(int groupId);
+    // 删除一个raft组，之后发给它的rpc都失败；等它已经发出的rpc结束后返回，不存在时返回false。
+    // 不能在定时线程中调用（比如apply回调里）
+    bool RemoveGroup(int groupId);
+
+    // 重写基类方法，按GroupId分发
+    void AppendEntries(google::protobuf::RpcController *controller,
+                       const ::raftRpcProto::AppendEntriesArgs *request,
+                       ::raftRpcProto::AppendEntriesReply *response,
+                       ::google::protobuf::Closure *done);
+    void InstallSnapshot(google::protobuf::RpcController *controller,
+                         const ::raftRpcProto::InstallSnapshotRequest *request,
+                         ::raftRpcProto::InstallSnapshotResponse *response,
+                         ::google::protobuf::Closure *done);
+    void RequestVote(google::protobuf::RpcController *controller,
+                     const ::raftRpcProto::RequestVoteArgs *request,
+                     ::raftRpcProto::RequestVoteReply *response,
+                     ::google::protobuf::Closure *done);
+    void ReadIndex(google::protobuf::RpcController *controller,
+                   const ::raftRpcProto::ReadIndexArgs *request,
+                   ::raftRpcProto::ReadIndexReply *response,
+                   ::google::protobuf::Closure *done);
+    void TimeoutNow(google::protobuf::RpcController *controller,
+                    const ::raftRpcProto::TimeoutNowArgs *request,
+                    ::raftRpcProto::TimeoutNowReply *response,
+                    ::google::protobuf::Closure *done);
+    void BatchAppendEntries(google::protobuf::RpcController *controller,
+                            const ::raftRpcProto::BatchAppendEntriesArgs *request,
+                            ::raftRpcProto::BatchAppendEntriesReply *response,
+                            ::google::protobuf::Closure *done);
+
+private:
+    int m_me;
+    std::vector<std::shared_ptr<RaftRpcUtil>> m_peers;
+    std::shared_ptr<PersistSyncer> m_syncer;
+    HeartBeatCoalescer m_heartBeatCoalescer;
+
+    std::mutex m_mtx;
+    std::unordered_map<int, std::shared_ptr<Raft>> m_groups;
+    // 定时线程遍历用的快照，添加组时重建，避免每个tick都拷贝m_groups
+    std::shared_ptr<const std::vector<std::shared_ptr<Raft>>> m_groupList;
+
+    std::thread m_tickThread;
+    std::atomic<bool> m_stop;
+
+    void tickLoop();
+    // 找不到组时设置rpc失败
+    std::shared_ptr<Raft> findGroup(google::protobuf::RpcController *controller, int groupId);
+};
+
+#endif
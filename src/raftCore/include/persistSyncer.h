@@ -0,0 +1,54 @@
+#ifndef PERSISTSYNCER_H
+#define PERSISTSYNCER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+class Persister;
+
+/**
+ * 组提交的落盘线程，可以被多个Persister共享
+ * Persister::AppendLog之后调用Notify，落盘线程攒批后依次对每个有未落盘日志的Persister做一次fdatasync。
+ * Multi-Raft下一个进程中的所有raft组共享一个PersistSyncer，不需要每个组一个落盘线程，
+ * 不同组的追加也能攒进同一批
+ */
+class PersistSyncer {
+public:
+    PersistSyncer();
+    // 确定性模拟用：不真正fdatasync，每次落盘改为在时钟上睡眠syncLatency来模拟磁盘延迟
+    explicit PersistSyncer(std::chrono::microseconds syncLatency);
+    ~PersistSyncer();
+
+    // persister有新的追加等待落盘；urgent为true时不等攒批，立即处理（用于执行已经落盘的回调）
+    void Notify(Persister *persister, bool urgent = false);
+    // persister析构前调用，之后不会再对它落盘
+    void Remove(Persister *persister);
+
+private:
+    std::mutex m_mtx;
+    std::condition_variable m_cond;
+    std::thread m_thread;
+    bool m_stop;
+    // 有未落盘追加的Persister，每个最多出现一次
+    std::deque<Persister *> m_pending;
+    // 这一批累计的追加次数
+    int m_pendingAppends;
+    // 有需要立即处理的Persister
+    bool m_urgent;
+    // 这一批最早一次追加的时间
+    std::chrono::_V2::system_clock::time_point m_firstPendingTime;
+    // 这一批正在依次落盘、还没轮到的Persister
+    std::deque<Persister *> m_batch;
+    // 正在落盘的Persister，Remove要等它完成
+    Persister *m_syncing;
+    // 是否模拟落盘，以及模拟的每次落盘耗时
+    const bool m_simulated;
+    const std::chrono::microseconds m_syncLatency;
+
+    void syncLoop();
+};
+
+#endif
@@ -5,14 +5,23 @@
 #include <boost/serialization/vector.hpp>
 #include <chrono>
 #include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <string>
 #include <thread>
 #include <vector>
 #include "ApplyMsg.h"
+#include "heartBeatCoalescer.h"
 #include "Persister.h"
+#include "raftConfig.h"
+#include "raftLog.h"
+#include "raftPersistCodec.h"
 #include "boost/any.hpp"
 #include "boost/serialization/serialization.hpp"
 #include "../../common/include/config.h"
@@ -42,16 +51,109 @@ private:
     std::shared_ptr<Persister> m_persister;
     // 自己
     int m_me;
+    // Multi-Raft：所属的raft组，单组时为0
+    int m_groupId;
+    // Multi-Raft：不为空时心跳交给它合并发送，定时器、applier和攒批都由MultiRaft调用tick()驱动
+    HeartBeatCoalescer *m_heartBeatCoalescer;
     int m_currentTerm;
     int m_votedFor;
+    // 当前任期已知的leader，follower读需要向它要readIndex，-1表示未知
+    int m_leaderId;
+    // 已经提交的成员配置，只有配置里的节点参与复制
+    // m_peers和每个节点一份的状态按节点id下标，随配置增长和收缩，不在配置中且没有连接的位置为nullptr
+    RaftConfig m_config;
+    // leader最后一条成员变更日志的logIndex，提交之前不接受新的变更
+    int m_pendingConfIndex;
     // 日志条目，包含状态机要执行的指令集，以及收到领导时的任期号
-    std::vector<raftRpcProto::LogEntry> m_logs;
+    // 下标0对应m_lastSnapshotIncludeIndex + 1，快照后截断前缀是O(1)的
+    RaftLog m_logs;
 
     int m_commitIndex;
     int m_lastApplied;
+    // 本节点WAL中已经fsync落盘的最大logIndex
+    // leader的日志在落盘的同时就发给follower，计算多数派时leader自己只算到这里
+    int m_persistedLogIndex;
+
+    // 增量持久化：term、votedFor、commitIndex等硬状态和日志分开保存
+    // 上一次写入raftState的硬状态，没有变化时（比如不推进commitIndex的心跳）不重写
+    RaftPersistHeader m_persistedHardState;
+    // 第一条被追加或覆盖、还没有写入WAL的logIndex，INT_MAX表示没有需要写入的日志
+    int m_logDirtyFrom;
+    // WAL中最后一条日志的logIndex，-1表示WAL为空
+    int m_walLastIndex;
 
     std::vector<int> m_nextIndex;
     std::vector<int> m_matchIndex;
+
+    // 流水线复制：发送时就乐观地推进m_nextIndex，每个follower最多APPEND_INFLIGHT_MAX个请求
+    // 或APPEND_INFLIGHT_MAX_BYTES字节的日志在途，被拒绝时再回退
+    std::vector<int> m_inflightCount;
+    std::vector<long long> m_inflightBytes;
+    // 窗口被重置时取一个新的序号，重置之前发出的请求的回复不再归还窗口
+    std::vector<int> m_inflightEpoch;
+    int m_inflightEpochSeq;
+    // 在途窗口最近一次有进展的时间，用来发现丢失的请求
+    std::vector<std::chrono::_V2::system_clock::time_point> m_inflightProgressTime;
+    // 每个follower的复制状态：
+    // ProgressProbe：还不知道从哪里开始匹配，同时只有一个在途请求，每个请求最多带一条日志，被拒绝就回退再探测；
+    // ProgressReplicate：已经匹配，日志按APPEND_MAX_ENTRIES条、APPEND_MAX_BYTES字节分块，在途窗口内连续发送；
+    // ProgressSnapshot：需要的日志已经被快照了，快照发完之前不发日志
+    enum ProgressState
+    {
+        ProgressProbe,
+        ProgressReplicate,
+        ProgressSnapshot
+    };
+    std::vector<ProgressState> m_progressState;
+
+    // ReadIndex读：leader每广播一次心跳就开启一个新的确认轮次，
+    // 多数节点回复了某一轮（或之后轮次）的请求，说明发出这一轮时自己仍然是leader
+    int64_t m_readRoundSeq;
+    // 每个节点回复过的最大轮次
+    std::vector<int64_t> m_peerAckRound;
+    // 正在等待的读请求需要的最大轮次
+    int64_t m_readRoundWanted;
+    // 轮次确认、m_lastApplied推进或者身份变化时唤醒等待的读请求，配合m_mtx使用
+    std::condition_variable m_readCond;
+    // 每一轮的开始时间（即广播心跳时的m_lastResetHearBeatTime），只保留还没有被确认的轮次和最近确认的一轮
+    // 多数节点确认了某一轮，说明它们在这一轮开始之后才重置选举超时，租约从这一刻算起
+    std::map<int64_t, std::chrono::_V2::system_clock::time_point> m_readRoundStartTime;
+    // commitIndex推进或者有快照要交给上层时唤醒applier，配合m_mtx使用
+    std::condition_variable m_applyCond;
+    // 已经安装、还没交给上层的快照，由applier排在之后的日志前面发出，nullptr表示没有
+    std::shared_ptr<ApplyMsg> m_pendingSnapshotMsg;
+    /**
+     * 提案入口单独加锁：Start()只持有m_proposalMtx，给提案分配logIndex后放进m_proposalQueue，
+     * 不和rpc处理、定时器、复制回调争抢m_mtx；攒够一批时再由持有m_mtx的一方追加到m_logs。
+     * 锁顺序：先m_mtx后m_proposalMtx。身份、term、领导权转移变化时，持有m_mtx的一方调用
+     * refreshProposalGate()同步到下面的字段；leader的m_logs之后紧接着就是m_proposalQueue中的提案
+     */
+    std::mutex m_proposalMtx;
+    // 是leader并且没有在转移领导权
+    bool m_proposalOpen;
+    int m_proposalTerm;
+    // 下一条提案的logIndex
+    int m_proposalNextIndex;
+    // 提案攒批：已经分配了logIndex、还没有追加到m_logs的提案
+    std::vector<raftRpcProto::LogEntry> m_proposalQueue;
+    long long m_proposalQueueBytes;
+    // 这一批第一条提案到达的时间
+    std::chrono::_V2::system_clock::time_point m_firstPendingProposalTime;
+    // 上一批发出的时间
+    std::chrono::_V2::system_clock::time_point m_lastProposalFlushTime;
+    // 有提案等待时唤醒proposalBatcher，配合m_proposalMtx使用
+    std::condition_variable m_proposalCond;
+    // 租约读统计：直接在租约内完成的读和退回ReadIndex确认的读
+    long long m_leaseReadCount;
+    long long m_leaseFallbackCount;
+    // 领导权转移的目标节点，-1表示没有在转移；转移期间不再接受新的日志
+    int m_leadTransferee;
+    // 超过这个时间目标节点还没有当选，放弃转移，恢复接受日志
+    std::chrono::_V2::system_clock::time_point m_leadTransferDeadline;
+    // 发出TimeoutNow之后目标节点跳过PreVote，可能马上当选，在此之前确认的租约都不能再用
+    std::chrono::_V2::system_clock::time_point m_leaseBlockedUntil;
+    // 目标节点的matchIndex推进或者身份变化时唤醒TransferLeadership，配合m_mtx使用
+    std::condition_variable m_transferCond;
     enum Status
     {
         Follower,
@@ -68,10 +170,27 @@ private:
     std::chrono::_V2::system_clock::time_point m_lastResetElectionTime;
     // 心跳超时，用于leader
     std::chrono::_V2::system_clock::time_point m_lastResetHearBeatTime;
+    // tick()使用的随机选举超时，每次选举后重新随机
+    std::chrono::milliseconds m_electionTimeout;
 
     // 储存快照中的最后一个日志的Index和Term
     int m_lastSnapshotIncludeIndex;
     int m_lastSnapshotIncludeTerm;
+    // 快照分块发送：每个follower同时只有一个发送线程
+    std::vector<bool> m_snapshotSending;
+    // 发给每个follower的AppendEntries按生成的顺序排队，由一个发送任务在有序连接上逐个发出，
+    // follower收到请求的顺序和leader生成的顺序一致
+    std::vector<std::deque<std::function<void()>>> m_appendQueue;
+    std::vector<bool> m_appendSending;
+    // 捕获了this的异步任务（发rpc的任务、合并心跳的回调、落盘回调）数，Shutdown等它们全部结束
+    int m_asyncTasks;
+    std::condition_variable m_asyncTasksCond;
+    // Shutdown之后不再驱动，也不再发起新的rpc
+    bool m_shutdown;
+    // 快照分块接收：正在接收的快照和已经写入临时文件的字节数，m_snapshotRecvIndex为-1表示没有在接收
+    int m_snapshotRecvIndex;
+    int m_snapshotRecvTerm;
+    long long m_snapshotRecvOffset;
 
     // 协程
     std::unique_ptr<monsoon::IOManager> m_ioManager = nullptr;
@@ -81,41 +200,126 @@ public:
     void AppendEntriesAnotherVersion(const raftRpcProto::AppendEntriesArgs *args, raftRpcProto::AppendEntriesReply *reply);
     void applierTicker();
     bool CondInstallSnapshot(int lastIncludedTerm, int lastIncludedIndex, std::string snapshot);
+    // 选举超时后先发起预投票，多数节点同意才真正增加term开始选举
     void doElection();
+    void startElection();
+    void becomeLeader();
     void doHeartBeat();
+    void broadcastHeartBeat();
 
     void electionTimeOutTicker();
     std::vector<ApplyMsg> getApplyLogs();
-    int getNewCommandIndex();
+    void proposalBatcher();
+    void flushProposals();
+    void appendProposals();
+    void drainProposalQueue();
+    void appendLeaderEntry(raftRpcProto::LogEntry *entry);
+    void refreshProposalGate();
     void getPrevLogInfo(int server, int *preIndex, int *preTerm);
     void GetState(int *term, bool *isLeader);
     void InstallSnapshot(const raftRpcProto::InstallSnapshotRequest *args,
                          raftRpcProto::InstallSnapshotResponse *reply);
     void leaderHearBeatTicker();
+    void leaderSendAppendEntries(int server, bool heartBeat);
     void leaderSendSnapShot(int server);
     void leaderUpdateCommitIndex();
+    // 推进commitIndex，新提交的成员变更日志在这里生效
+    void advanceCommitIndex(int commitIndex);
+    void applyConfChange(const raftRpcProto::LogEntry &entry);
+    void syncPeers(const RaftConfig &oldConfig);
+    void resizePeers(int size);
+    bool proposeConfChange(const raftRpcProto::ConfChange &cc);
+    raftRpcProto::ConfChange newMemberChange(raftRpcProto::ConfChangeType type, int server,
+                                             const raftRpcProto::PeerAddr *addr);
+    bool learnerCaughtUp(int server);
     bool matchLog(int logIndex, int logTerm);
+    void markLogDirty(int logIndex);
+    void truncateLogSuffix(int fromIndex);
     void persist();
+    RaftPersistHeader hardState();
+    void persistHardState();
+    uint64_t persistLog();
     void RequestVote(const raftRpcProto::RequestVoteArgs *args, raftRpcProto::RequestVoteReply *reply);
     bool UpToDate(int index, int term);
     int getLastLogIndex();
     int getLastLogTerm();
     void getLastLogIndexAndTerm(int *lastLogIndex, int *lastLogTerm);
     int getLogTermFromLogIndex(int logIndex);
+    // 日志的term随index单调不减，二分查找
+    // (快照, maxIndex]中term为term的第一条日志，调用方保证maxIndex处的term就是term
+    int getFirstLogIndexOfTerm(int term, int maxIndex);
+    // [快照, maxIndex]中term为term的最后一条日志，没有则返回-1
+    int getLastLogIndexOfTerm(int term, int maxIndex);
     int GetRaftStateSize();
     int getSlicesIndexFromLogIndex(int logIndex);
 
-    bool sendRequestVote(int server, std::shared_ptr<raftRpcProto::RequestVoteArgs> args,
-                         std::shared_ptr<raftRpcProto::RequestVoteReply> reply, std::shared_ptr<int> votedNum);
-    bool sendAppendEntries(int server, std::shared_ptr<raftRpcProto::AppendEntriesArgs> args,
-                           std::shared_ptr<raftRpcProto::AppendEntriesReply> reply, std::shared_ptr<int> appendNums);
+    // 调用方在锁内取出peer，发送期间节点被移除也不影响这次请求
+    bool sendRequestVote(int server, std::shared_ptr<RaftRpcUtil> peer,
+                         std::shared_ptr<raftRpcProto::RequestVoteArgs> args,
+                         std::shared_ptr<raftRpcProto::RequestVoteReply> reply, std::shared_ptr<std::set<int>> votes);
+    bool sendAppendEntries(int server, std::shared_ptr<RaftRpcUtil> peer,
+                           std::shared_ptr<raftRpcProto::AppendEntriesArgs> args,
+                           std::shared_ptr<raftRpcProto::AppendEntriesReply> reply, int inflightEpoch,
+                           long long inflightBytes, int64_t readRound);
+    // 依次发送m_appendQueue[server]中的请求，队列空了就退出
+    void appendSendLoop(int server);
+    // 启动一个计入m_asyncTasks的异步任务，Shutdown之后直接丢弃；调用前需要持有m_mtx
+    void spawnTask(std::function<void()> task);
+    // 异步任务结束
+    void finishTask();
+    void handleAppendEntriesReply(int server, std::shared_ptr<raftRpcProto::AppendEntriesArgs> args,
+                                  std::shared_ptr<raftRpcProto::AppendEntriesReply> reply, int inflightEpoch,
+                                  long long inflightBytes, int64_t readRound, bool ok);
+    void resetInflight(int server);
+    void becomeProgress(int server, ProgressState state);
 
-    void pushMsgToKvServer(ApplyMsg msg);
+    void onLogPersisted(int logIndex, int logTerm);
+    bool hasApplyWork();
     void readPersist(std::string data);
     std::string persistData();
 
     void Start(OperaionFromRaft command, int *newLogIndex, int *newLogTerm, bool *isLeader);
+    // 线性一致读，不写日志：leader记下commitIndex，用一轮心跳确认自己仍是leader，
+    // 再等m_lastApplied追上它，并发的读共享同一轮确认；
+    // follower通过ReadIndex rpc向leader要readIndex，再等自己的m_lastApplied追上它。
+    // 返回false表示找不到leader、本任期还没有提交过日志或者超时，调用方应退回到走日志的读。
+    // 返回true后，上层状态机也要执行到readIndex之后才能读
+    bool ReadIndex(int *readIndex);
+    bool leaderReadIndex(std::unique_lock<std::mutex> *lock, std::chrono::_V2::system_clock::time_point deadline,
+                         int *readIndex);
+    void ReadIndex(const raftRpcProto::ReadIndexArgs *args, raftRpcProto::ReadIndexReply *reply);
+    int64_t readRoundConfirmed();
+    bool leaseValid();
+    void GetLeaseReadStats(long long *leaseReads, long long *fallbackReads);
     void Snapshot(int index, std::string snapshot);
+    void compactLog(int index, std::string snapshot);
+    // 领导权转移：停止接受日志，把target的日志追平后发送TimeoutNow，让它不等选举超时直接发起选举
+    // 返回true只表示target已经开始选举，是否当选要看之后的term
+    bool TransferLeadership(int target);
+    void TimeoutNow(const raftRpcProto::TimeoutNowArgs *args, raftRpcProto::TimeoutNowReply *reply);
+    // 成员变更，只能在leader上发起，返回true只表示变更日志已经追加，提交之后才生效
+    // 新节点先作为learner追赶日志，不影响提交；落后leader不超过LEARNER_CATCHUP_MAX_LAG条之后才能提升为voter
+    bool AddLearner(int server);
+    // 启动时没有连接的新节点需要带上地址，地址随配置复制和持久化
+    bool AddLearner(int server, const std::string &ip, short port);
+    bool PromoteLearner(int server);
+    bool RemoveLearner(int server);
+    // witness直接作为voter加入：只保存日志的term和index并参与投票，不保存Command、不执行、不会成为leader
+    // 能和两个完整副本组成三个voter的集群，但只有一个完整副本存活时无法选出leader
+    bool AddWitness(int server);
+    bool AddWitness(int server, const std::string &ip, short port);
+    // 联合共识：把voter集合整体换成voters，其中新的voter必须是已经追上的learner
+    // 过渡配置提交后leader自动离开过渡配置；不在新集合中的leader在离开之后退位
+    bool ChangeVoters(const std::vector<int> &voters);
+    RaftConfig GetConfig();
+
+    // 处理AppendEntries请求，回复之前等待日志落盘
+    void AppendEntries(const raftRpcProto::AppendEntriesArgs *args, raftRpcProto::AppendEntriesReply *reply);
+    // 只处理请求、不等待落盘，返回回复之前需要落盘的序号（交给WaitDurable）；
+    // Multi-Raft合并的请求先让所有组写完WAL再统一等待，各组的追加进入同一批fsync
+    uint64_t AppendEntriesDeferSync(const raftRpcProto::AppendEntriesArgs *args,
+                                    raftRpcProto::AppendEntriesReply *reply);
+    void WaitDurable(uint64_t ticket);
 
     // 重写基类方法
     void AppendEntries(google::protobuf::RpcController *controller,
@@ -130,34 +334,34 @@ public:
                      const ::raftRpcProto::RequestVoteArgs *request,
                      ::raftRpcProto::RequestVoteReply *response,
                      ::google::protobuf::Closure *done);
+    void ReadIndex(google::protobuf::RpcController *controller,
+                   const ::raftRpcProto::ReadIndexArgs *request,
+                   ::raftRpcProto::ReadIndexReply *response,
+                   ::google::protobuf::Closure *done);
+    void TimeoutNow(google::protobuf::RpcController *controller,
+                    const ::raftRpcProto::TimeoutNowArgs *request,
+                    ::raftRpcProto::TimeoutNowReply *response,
+                    ::google::protobuf::Closure *done);
 
     void init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::shared_ptr<Persister> persister,
               std::shared_ptr<LockQueue<ApplyMsg>> applyCh);
+    // bootstrap是第一次启动（没有持久化的配置）时的成员配置，
+    // 以learner加入已有集群的新节点传入空配置，从leader的日志或快照中得到配置
+    void init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::shared_ptr<Persister> persister,
+              std::shared_ptr<LockQueue<ApplyMsg>> applyCh, const RaftConfig &bootstrap);
+    // Multi-Raft：只初始化状态，不启动自己的定时器和线程，由MultiRaft周期调用tick()
+    void initGroup(int groupId, std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me,
+                   std::shared_ptr<Persister> persister, std::shared_ptr<LockQueue<ApplyMsg>> applyCh,
+                   HeartBeatCoalescer *heartBeatCoalescer);
+    // 检查一次选举超时、心跳、攒批窗口和待apply的日志，不阻塞；返回这次是否做了其中任何一件事
+    bool tick();
+    // Multi-Raft删除组：不再被驱动、不再发起rpc，等已经发出的rpc任务、合并心跳的回调和落盘回调都结束后返回，
+    // 之后可以销毁这个对象。合并心跳要靠MultiRaft的定时线程发出，不能在定时线程中调用
+    void Shutdown();
 
 private:
-    class BoostPersistRaftNode
-    {
-    public:
-        friend class boost::serialization::access;
-        // When the class Archive corresponds to an output archive, the
-        // & operator is defined similar to <<.  Likewise, when the class Archive
-        // is a type of input archive the & operator is defined similar to >>.
-        template <class Archive>
-        void serialize(Archive &ar, const unsigned int version)
-        {
-            ar &m_currentTerm;
-            ar &m_votedFor;
-            ar &m_lastSnapshotIncludeIndex;
-            ar &m_lastSnapshotIncludeTerm;
-            ar &m_logs;
-        }
-        int m_currentTerm;
-        int m_votedFor;
-        int m_lastSnapshotIncludeIndex;
-        int m_lastSnapshotIncludeTerm;
-        std::vector<std::string> m_logs;
-        std::unordered_map<std::string, int> umap;
-    };
+    void initState(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::shared_ptr<Persister> persister,
+                   std::shared_ptr<LockQueue<ApplyMsg>> applyCh, const RaftConfig &bootstrap);
 };
 
 #endif
\ No newline at end of file
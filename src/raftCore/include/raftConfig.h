@@ -0,0 +1,72 @@
+#ifndef RAFTCONFIG_H
+#define RAFTCONFIG_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include "../../raftRpcProto/include/raftRPC.pb.h"
+
+/**
+ * 集群成员配置：voter参与选举和提交的多数派，learner只接收日志和快照，
+ * witness是只保存日志term/index的voter，用很少的磁盘和带宽凑出第三个投票者
+ * 节点用它在m_peers中的下标（节点id）表示，m_peers中不在配置里的节点不收发任何请求
+ * 成员变更日志提交之后才生效（和etcd一样），同一时刻只允许有一个没提交的变更：
+ * 1. 增删learner、提升learner不改变多数派或者只改变一个voter，新旧配置的多数派一定相交；
+ * 2. 一次改变多个voter时使用联合共识，先进入新旧voter集合共同决定的过渡配置（joint），
+ *    过渡期间的选举和提交需要两个集合各自的多数派，过渡配置提交之后再离开
+ */
+class RaftConfig {
+public:
+    // 空配置：没有voter，节点不会发起选举，等leader通过日志或快照告诉它配置
+    RaftConfig();
+    // 兼容原来的静态配置：m_peers中的所有节点都是voter，其中witnesses是witness
+    static RaftConfig AllVoters(int peerCount, const std::set<int> &witnesses = std::set<int>());
+
+    // 过渡配置中新旧集合里的voter都算
+    bool IsVoter(int id) const { return m_voters.count(id) > 0 || m_outgoing.count(id) > 0; }
+    bool IsLearner(int id) const { return m_learners.count(id) > 0; }
+    bool IsWitness(int id) const { return m_witnesses.count(id) > 0; }
+    bool Contains(int id) const { return IsVoter(id) || IsLearner(id); }
+    bool Joint() const { return !m_outgoing.empty(); }
+    const std::set<int> &Voters() const { return m_voters; }
+    const std::set<int> &OutgoingVoters() const { return m_outgoing; }
+    const std::set<int> &Learners() const { return m_learners; }
+    // 配置中的所有节点
+    std::set<int> Members() const;
+    // 通过成员变更加入的节点的地址，启动时就有连接的节点没有
+    const std::map<int, raftRpcProto::PeerAddr> &Addrs() const { return m_addrs; }
+    // 产生这个配置的成员变更日志的logIndex，小于等于它的变更日志都已经生效过
+    int Index() const { return m_index; }
+
+    // 检查变更对当前配置是否合法
+    bool Valid(const raftRpcProto::ConfChange &cc) const;
+    // 应用logIndex处提交的变更，不合法的变更只推进Index，返回false
+    bool Apply(const raftRpcProto::ConfChange &cc, int logIndex);
+
+    // acked(id)为true的voter是否构成多数派，过渡配置中新旧集合都要是多数派
+    bool HasQuorum(const std::function<bool(int)> &acked) const;
+    // 多数voter都达到了的最大值，没有voter时返回-1
+    int64_t QuorumValue(const std::function<int64_t(int)> &value) const;
+
+    void ToProto(raftRpcProto::ClusterConfig *config) const;
+    static RaftConfig FromProto(const raftRpcProto::ClusterConfig &config);
+    std::string Encode() const;
+    static bool Decode(const std::string &data, RaftConfig *config);
+
+private:
+    std::set<int> m_voters;
+    // 过渡配置中的旧voter集合，不在过渡配置时为空
+    std::set<int> m_outgoing;
+    std::set<int> m_learners;
+    // voter中的witness
+    std::set<int> m_witnesses;
+    std::map<int, raftRpcProto::PeerAddr> m_addrs;
+    int m_index;
+
+    static bool hasQuorum(const std::set<int> &voters, const std::function<bool(int)> &acked);
+    static int64_t quorumValue(const std::set<int> &voters, const std::function<int64_t(int)> &value);
+};
+
+#endif
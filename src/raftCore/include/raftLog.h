@@ -0,0 +1,101 @@
+#ifndef RAFTLOG_H
+#define RAFTLOG_H
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <vector>
+#include "../../raftRpcProto/include/raftRPC.pb.h"
+
+/**
+ * raft内存日志容器，代替std::vector<raftRpcProto::LogEntry>
+ * 日志按固定大小的块（kBlockSize条）存放，块内空间预先reserve，追加时不会重新分配，
+ * 所以已有条目的引用在追加和截断其他位置时保持有效。
+ * 下标和原来的m_logs一致：0对应快照之后的第一条日志（m_lastSnapshotIncludeIndex + 1）。
+ * 快照之后的前缀截断只需要移动首块内的偏移并丢弃整块，不再拷贝剩下的日志。
+ */
+class RaftLog {
+public:
+    static constexpr size_t kBlockSize = 1024;
+
+    template <class Log, class Entry>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = raftRpcProto::LogEntry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Entry *;
+        using reference = Entry &;
+
+        Iterator(Log *log, size_t pos) : m_log(log), m_pos(pos) {}
+        reference operator*() const { return (*m_log)[m_pos]; }
+        pointer operator->() const { return &(*m_log)[m_pos]; }
+        Iterator &operator++()
+        {
+            ++m_pos;
+            return *this;
+        }
+        bool operator==(const Iterator &other) const { return m_pos == other.m_pos; }
+        bool operator!=(const Iterator &other) const { return m_pos != other.m_pos; }
+
+    private:
+        Log *m_log;
+        size_t m_pos;
+    };
+    using iterator = Iterator<RaftLog, raftRpcProto::LogEntry>;
+    using const_iterator = Iterator<const RaftLog, const raftRpcProto::LogEntry>;
+
+    RaftLog();
+
+    raftRpcProto::LogEntry &operator[](size_t i)
+    {
+        size_t pos = m_head + i;
+        return (*m_blocks[pos / kBlockSize])[pos % kBlockSize];
+    }
+    const raftRpcProto::LogEntry &operator[](size_t i) const
+    {
+        size_t pos = m_head + i;
+        return (*m_blocks[pos / kBlockSize])[pos % kBlockSize];
+    }
+    raftRpcProto::LogEntry &back() { return (*this)[m_size - 1]; }
+    const raftRpcProto::LogEntry &back() const { return (*this)[m_size - 1]; }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    void push_back(const raftRpcProto::LogEntry &entry);
+    void push_back(raftRpcProto::LogEntry &&entry);
+    template <class... Args>
+    raftRpcProto::LogEntry &emplace_back(Args &&...args)
+    {
+        reserveTail();
+        m_blocks.back()->emplace_back(std::forward<Args>(args)...);
+        ++m_size;
+        return back();
+    }
+    void clear();
+
+    // 删除前n条日志，整块释放，块内只移动偏移
+    void truncatePrefix(size_t n);
+    // 只保留前n条日志，follower的日志和leader冲突时使用
+    void truncateSuffix(size_t n);
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, m_size); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, m_size); }
+
+private:
+    using Block = std::vector<raftRpcProto::LogEntry>;
+
+    std::deque<std::unique_ptr<Block>> m_blocks;
+    // 第一条日志在首块中的偏移
+    size_t m_head;
+    size_t m_size;
+
+    // 保证最后一块还有空位
+    void reserveTail();
+};
+
+#endif
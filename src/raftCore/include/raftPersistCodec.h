@@ -0,0 +1,181 @@
+#ifndef RAFTPERSISTCODEC_H
+#define RAFTPERSISTCODEC_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../../raftRpcProto/include/raftRPC.pb.h"
+
+// 需要持久化的raft状态（不含日志），日志单独保存在WAL中
+struct RaftPersistHeader
+{
+    int32_t currentTerm;
+    int32_t votedFor;
+    int32_t commitIndex;
+    int32_t lastSnapshotIncludeIndex;
+    int32_t lastSnapshotIncludeTerm;
+    // 编码后的成员配置（RaftConfig::Encode），和commitIndex一起保存，为空表示没有保存过
+    std::string config;
+
+    bool operator==(const RaftPersistHeader &other) const
+    {
+        return currentTerm == other.currentTerm && votedFor == other.votedFor && commitIndex == other.commitIndex &&
+               lastSnapshotIncludeIndex == other.lastSnapshotIncludeIndex &&
+               lastSnapshotIncludeTerm == other.lastSnapshotIncludeTerm && config == other.config;
+    }
+    bool operator!=(const RaftPersistHeader &other) const { return !(*this == other); }
+};
+
+/**
+ * raft持久化状态的二进制编码，代替boost text_oarchive；和原格式的编解码耗时对比见src/bench/persistCodecBench.cpp
+ * 固定长度的头部：
+ * [uint32 magic][uint16 version][uint16 reserved]
+ * [int32 currentTerm][int32 votedFor][int32 commitIndex][int32 lastSnapshotIncludeIndex][int32 lastSnapshotIncludeTerm]
+ * [uint32 entryCount][uint32 configLen][config]
+ * 之后是entryCount条日志，每条：[int32 logIndex][int32 logTerm][uint32 commandLen|type<<24][command]
+ * 所有整数都是本机字节序，command直接拷贝，不再经过protobuf序列化
+ * version 2 在头部加入了commitIndex；raft本身的持久化只写头部（entryCount为0），日志在WAL中
+ * version 3 在头部之后加入了成员配置，仍然可以读取version 2（config为空）
+ * version 4 和WAL一样用commandLen的高8位保存日志类型（EntryType），所以单条command最长16MB；
+ * 旧版本的日志都按EntryNormal读出
+ */
+class RaftStateCodec {
+public:
+    static constexpr uint32_t kMagic = 0x52465453; // "RFTS"
+    static constexpr uint16_t kVersion = 4;
+    static constexpr size_t kHeaderSize = 32;
+    static constexpr size_t kEntryHeaderSize = 12;
+    static constexpr int kEntryTypeShift = 24;
+    static constexpr uint32_t kCommandLenMask = (1u << kEntryTypeShift) - 1;
+
+    // 只编码头部
+    static std::string Encode(const RaftPersistHeader &header)
+    {
+        return Encode(header, std::vector<raftRpcProto::LogEntry>());
+    }
+
+    // Logs是按logIndex顺序遍历raftRpcProto::LogEntry的容器
+    template <class Logs>
+    static std::string Encode(const RaftPersistHeader &header, const Logs &logs)
+    {
+        // 先算出总长度，一次分配
+        size_t total = kHeaderSize + 4 + header.config.size();
+        uint32_t entryCount = 0;
+        for (const auto &entry : logs)
+        {
+            total += kEntryHeaderSize + entry.command().size();
+            ++entryCount;
+        }
+
+        std::string buf(total, '\0');
+        char *p = &buf[0];
+        p = put(p, kMagic);
+        p = put(p, kVersion);
+        p = put(p, static_cast<uint16_t>(0));
+        p = put(p, header.currentTerm);
+        p = put(p, header.votedFor);
+        p = put(p, header.commitIndex);
+        p = put(p, header.lastSnapshotIncludeIndex);
+        p = put(p, header.lastSnapshotIncludeTerm);
+        p = put(p, entryCount);
+        p = put(p, static_cast<uint32_t>(header.config.size()));
+        memcpy(p, header.config.data(), header.config.size());
+        p += header.config.size();
+
+        for (const auto &entry : logs)
+        {
+            const std::string &command = entry.command();
+            p = put(p, static_cast<int32_t>(entry.logindex()));
+            p = put(p, static_cast<int32_t>(entry.logterm()));
+            uint32_t lenAndType = static_cast<uint32_t>(command.size());
+            lenAndType |= static_cast<uint32_t>(entry.type()) << kEntryTypeShift;
+            p = put(p, lenAndType);
+            memcpy(p, command.data(), command.size());
+            p += command.size();
+        }
+        return buf;
+    }
+
+    // 直接把日志解码进logs（需要支持emplace_back，调用方可以事先reserve），logs为nullptr时只解析头部
+    // 格式或版本不对时返回false
+    template <class Logs>
+    static bool Decode(const std::string &data, RaftPersistHeader *header, Logs *logs)
+    {
+        if (data.size() < kHeaderSize)
+            return false;
+        const char *p = data.data();
+        const char *end = data.data() + data.size();
+        uint32_t magic;
+        uint16_t version;
+        uint16_t reserved;
+        uint32_t entryCount;
+        p = get(p, &magic);
+        p = get(p, &version);
+        p = get(p, &reserved);
+        if (magic != kMagic || version < 2 || version > kVersion)
+            return false;
+        p = get(p, &header->currentTerm);
+        p = get(p, &header->votedFor);
+        p = get(p, &header->commitIndex);
+        p = get(p, &header->lastSnapshotIncludeIndex);
+        p = get(p, &header->lastSnapshotIncludeTerm);
+        p = get(p, &entryCount);
+        header->config.clear();
+        if (version >= 3)
+        {
+            uint32_t configLen;
+            if (end - p < 4)
+                return false;
+            p = get(p, &configLen);
+            if (static_cast<size_t>(end - p) < configLen)
+                return false;
+            header->config.assign(p, configLen);
+            p += configLen;
+        }
+        if (logs == nullptr)
+            return true;
+
+        for (uint32_t i = 0; i < entryCount; ++i)
+        {
+            if (end - p < static_cast<ptrdiff_t>(kEntryHeaderSize))
+                return false;
+            int32_t logIndex;
+            int32_t logTerm;
+            uint32_t lenAndType;
+            p = get(p, &logIndex);
+            p = get(p, &logTerm);
+            p = get(p, &lenAndType);
+            uint32_t commandLen = version >= 4 ? lenAndType & kCommandLenMask : lenAndType;
+            if (static_cast<size_t>(end - p) < commandLen)
+                return false;
+
+            logs->emplace_back();
+            auto &entry = logs->back();
+            entry.set_logindex(logIndex);
+            entry.set_logterm(logTerm);
+            if (version >= 4)
+                entry.set_type(static_cast<raftRpcProto::EntryType>(lenAndType >> kEntryTypeShift));
+            entry.set_command(p, commandLen);
+            p += commandLen;
+        }
+        return p == end;
+    }
+
+private:
+    template <class T>
+    static char *put(char *p, T value)
+    {
+        memcpy(p, &value, sizeof(T));
+        return p + sizeof(T);
+    }
+
+    template <class T>
+    static const char *get(const char *p, T *value)
+    {
+        memcpy(value, p, sizeof(T));
+        return p + sizeof(T);
+    }
+};
+
+#endif
@@ -1,26 +1,65 @@
 #ifndef RAFTRPC_H
 #define RAFTRPC_H
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <string>
+#include "../../common/include/config.h"
 #include "../../raftRpcProto/include/raftRPC.pb.h"
 
+/**
+ * 到一个对端节点的rpc。方法都是虚函数，确定性模拟时用子类代替真实连接，
+ * 由模拟网络决定延迟、丢包、乱序和分区
+ */
 class RaftRpcUtil {
 private:
-    raftRpcProto::raftRpc_Stub *stub_;
+    // 一条连接同一时间只能有一个请求在等待回复。
+    // 第一条连接专门给AppendEntries（包括合并心跳），同一对端的日志复制请求按发送顺序到达；
+    // 其余连接轮流给投票、快照、ReadIndex等不要求顺序的请求，它们不会排在日志复制后面
+    struct Connection
+    {
+        std::mutex mtx;
+        raftRpcProto::raftRpc_Stub *stub;
+    };
+    std::vector<std::unique_ptr<Connection>> conns_;
+    // 轮询起点
+    std::atomic<unsigned> next_;
+
+    // ordered为true时取有序连接；否则在其余连接中优先取一个空闲的，都在使用时等待轮询到的那条
+    Connection *acquire(bool ordered, std::unique_lock<std::mutex> *lock);
 
 public:
     // 主动调用其他节点的方法
 
     // 日志一致性检查
-    bool AppendEntries(raftRpcProto::AppendEntriesArgs *args, raftRpcProto::AppendEntriesReply *response);
+    virtual bool AppendEntries(raftRpcProto::AppendEntriesArgs *args, raftRpcProto::AppendEntriesReply *response);
 
     // 快照机制
-    bool InstallSnapshot(raftRpcProto::InstallSnapshotRequest *args, raftRpcProto::InstallSnapshotResponse *response);
+    virtual bool InstallSnapshot(raftRpcProto::InstallSnapshotRequest *args,
+                                 raftRpcProto::InstallSnapshotResponse *response);
 
     // 拉票请求
-    bool RequestVote(raftRpcProto::RequestVoteArgs *args, raftRpcProto::RequestVoteReply *response);
+    virtual bool RequestVote(raftRpcProto::RequestVoteArgs *args, raftRpcProto::RequestVoteReply *response);
+
+    // follower读取leader的readIndex
+    virtual bool ReadIndex(raftRpcProto::ReadIndexArgs *args, raftRpcProto::ReadIndexReply *response);
+
+    // 领导权转移时通知目标节点立即发起选举
+    virtual bool TimeoutNow(raftRpcProto::TimeoutNowArgs *args, raftRpcProto::TimeoutNowReply *response);
+
+    // Multi-Raft：合并后的心跳
+    virtual bool BatchAppendEntries(raftRpcProto::BatchAppendEntriesArgs *args,
+                                    raftRpcProto::BatchAppendEntriesReply *response);
+
+    // lazy为true时所有连接都在第一次使用时才建立，构造不会阻塞（成员变更时在锁内创建）
+    RaftRpcUtil(std::string ip, short port, int connections = RPC_CONNECTIONS_PER_PEER, bool lazy = false);
+    virtual ~RaftRpcUtil();
 
-    RaftRpcUtil(std::string ip, short port);
-    ~RaftRpcUtil();
+protected:
+    // 给模拟网络的子类用，不建立任何连接
+    RaftRpcUtil();
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,214 @@
+#ifndef RAFTSIM_H
+#define RAFTSIM_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+#include "../../common/include/util.h"
+#include "ApplyMsg.h"
+#include "persistSyncer.h"
+#include "raft.h"
+#include "raftRpcUtil.h"
+
+/**
+ * 确定性模拟：N个Raft运行在虚拟时钟和模拟网络上，不建立连接，也不真正睡眠。
+ * 各节点像Multi-Raft一样由模拟器线程调用tick()驱动；发rpc的任务由SimClock::Spawn启动，
+ * 所有线程都停下等待时模拟器才把虚拟时间直接推进到下一个到期时刻，所以比真实时间快得多。
+ * 网络延迟、丢包（以及由延迟不同产生的乱序）和选举超时都由种子决定。
+ * 同一虚拟时刻被唤醒的多个线程之间的先后仍由操作系统调度，
+ * 所以同一个种子的统计结果可以重放，但不保证每条消息的交错完全一致
+ */
+struct SimOptions
+{
+    int nodes = 3;
+    unsigned seed = 1;
+    // 单向消息延迟在[minDelayUs, maxDelayUs]之间均匀分布，延迟不同的消息会乱序到达
+    int minDelayUs = 500;
+    int maxDelayUs = 2000;
+    // 请求或回复被丢弃的概率
+    double dropRate = 0.0;
+    // 请求或回复丢失时，发送方在这么久之后得到失败，模拟rpc超时
+    int rpcTimeoutUs = 50000;
+    // 模拟的一次fdatasync耗时，模拟时不真正落盘
+    int fsyncUs = 200;
+    // 调用各节点tick()的虚拟时间间隔
+    int tickUs = MULTI_RAFT_TICK_MS * 1000;
+    // 所有线程都停下之后再观察这么久的真实时间，确认没有刚被唤醒、还没来得及运行的线程
+    int settleUs = 20;
+};
+
+/**
+ * 虚拟时钟：时间只由模拟器线程通过AdvanceTo推进。
+ * 调用过它的等待函数的线程和Spawn启动的任务都被跟踪，记录有多少还在运行
+ */
+class SimClock : public Clock {
+public:
+    explicit SimClock(std::chrono::microseconds settle);
+
+    std::chrono::_V2::system_clock::time_point Now() override;
+    void SleepFor(std::chrono::microseconds duration) override;
+    void WaitUntil(std::condition_variable &cond, std::unique_lock<std::mutex> &lock,
+                   std::chrono::_V2::system_clock::time_point deadline) override;
+    void Wait(std::condition_variable &cond, std::unique_lock<std::mutex> &lock) override;
+    void Spawn(std::function<void()> task) override;
+
+    // 以下由模拟器线程调用，模拟器线程自己不能在时钟上等待
+
+    // 等到所有被跟踪的线程都停下等待
+    void WaitIdle();
+    // 模拟器线程做了可能唤醒其他线程的事情（驱动了raft、提交了提案），下一次WaitIdle要观察一段时间
+    void Touch();
+    // 最早到期的睡眠或者等待，没有时返回time_point::max()
+    std::chrono::_V2::system_clock::time_point NextDeadline();
+    // 推进时间并唤醒到期的睡眠和等待，t不早于当前时间
+    void AdvanceTo(std::chrono::_V2::system_clock::time_point t);
+    // 结束模拟：时间跳到足够远，之后的睡眠和等待把时间推进到自己的到期时刻并立即返回；等所有Spawn的任务结束
+    void Stop();
+
+private:
+    // 一个带超时的等待，唤醒时要先拿到它的mutex再notify，避免丢失唤醒
+    struct Waiter
+    {
+        std::condition_variable *cond;
+        std::mutex *mutex;
+    };
+
+    std::mutex m_mtx;
+    // 被跟踪的线程停下或者任务结束时通知WaitIdle和Stop
+    std::condition_variable m_idleCond;
+    // SleepFor在这里等待
+    std::condition_variable m_sleepCond;
+    std::chrono::_V2::system_clock::time_point m_now;
+    const std::chrono::microseconds m_settle;
+    bool m_stopped;
+    // 被跟踪、没有停下等待的线程数
+    int m_running;
+    // Spawn启动、还没有结束的任务数
+    int m_tasks;
+    // 每次有线程停下或者醒来都加一，WaitIdle据此判断是否稳定
+    uint64_t m_activity;
+    // 上一次WaitIdle返回时的m_activity，之后没有任何活动就不需要再观察
+    uint64_t m_idleActivity;
+    std::multiset<std::chrono::_V2::system_clock::time_point> m_sleepers;
+    std::multimap<std::chrono::_V2::system_clock::time_point, std::shared_ptr<Waiter>> m_waiters;
+
+    friend struct SimThread;
+    // 当前线程开始等待，返回它是否被跟踪；调用前需要持有m_mtx
+    bool park();
+    // 调用前需要持有m_mtx
+    void unpark(bool tracked);
+    // 还有线程没有停下，或者有到期的睡眠和等待还没醒来；调用前需要持有m_mtx
+    bool busy();
+    void threadExit(bool task);
+};
+
+class SimNetwork;
+
+// 节点from到节点to的模拟连接，每个rpc都交给SimNetwork投递
+class SimRpcUtil : public RaftRpcUtil {
+public:
+    SimRpcUtil(SimNetwork *network, int from, int to);
+
+    bool AppendEntries(raftRpcProto::AppendEntriesArgs *args, raftRpcProto::AppendEntriesReply *response) override;
+    bool InstallSnapshot(raftRpcProto::InstallSnapshotRequest *args,
+                         raftRpcProto::InstallSnapshotResponse *response) override;
+    bool RequestVote(raftRpcProto::RequestVoteArgs *args, raftRpcProto::RequestVoteReply *response) override;
+    bool ReadIndex(raftRpcProto::ReadIndexArgs *args, raftRpcProto::ReadIndexReply *response) override;
+    bool TimeoutNow(raftRpcProto::TimeoutNowArgs *args, raftRpcProto::TimeoutNowReply *response) override;
+    // 模拟的是单组集群，不使用心跳合并
+    bool BatchAppendEntries(raftRpcProto::BatchAppendEntriesArgs *args,
+                            raftRpcProto::BatchAppendEntriesReply *response) override;
+
+private:
+    SimNetwork *m_network;
+    int m_from;
+    int m_to;
+};
+
+/**
+ * 模拟网络：请求和回复各经过一次随机延迟，按概率丢弃；分区之间的消息全部丢弃。
+ * 每条链路上第k条消息的命运只由(种子, from, to, k)决定，和其他链路上的发送顺序无关
+ */
+class SimNetwork {
+public:
+    explicit SimNetwork(const SimOptions &options);
+
+    void SetNodes(std::vector<std::shared_ptr<Raft>> nodes);
+    // 把节点分成若干组，组之间不通；不在任何组中的节点被完全隔离
+    void Partition(const std::vector<std::vector<int>> &groups);
+    // 恢复全连通
+    void Heal();
+    void SetDropRate(double dropRate);
+    // 之后的rpc都立即失败
+    void Stop();
+
+    // 在发送方线程中把一次rpc投递给to并等待回复，返回false表示请求或回复丢失
+    bool Call(int from, int to, const std::function<void(Raft *)> &handler);
+
+    long long Sent();
+    long long Dropped();
+
+private:
+    std::mutex m_mtx;
+    SimOptions m_options;
+    std::vector<std::shared_ptr<Raft>> m_nodes;
+    // 每个节点所在的分区
+    std::vector<int> m_group;
+    // 每条链路已经发出的消息数
+    std::map<std::pair<int, int>, uint64_t> m_linkSeq;
+    bool m_stopped;
+    long long m_sent;
+    long long m_dropped;
+
+    // 调用前需要持有m_mtx
+    bool connected(int from, int to);
+    // 调用前需要持有m_mtx
+    uint64_t nextRandom(int from, int to);
+};
+
+/**
+ * 模拟集群：虚拟时钟、模拟网络和N个以tick方式运行的Raft。
+ * 构造时安装虚拟时钟和随机种子，析构时恢复系统时钟，同一时间只能有一个SimCluster
+ */
+class SimCluster {
+public:
+    // 每条apply到上层的消息都在模拟器线程中回调
+    using ApplyCallback = std::function<void(int node, const ApplyMsg &msg)>;
+
+    explicit SimCluster(const SimOptions &options);
+    ~SimCluster();
+
+    // 推进duration的虚拟时间；每个tick之后调用onTick，它在模拟器线程中运行，不能阻塞，
+    // 做了可能唤醒其他线程的事情（比如提交了提案）时返回true
+    void RunFor(std::chrono::microseconds duration, const std::function<bool()> &onTick = nullptr);
+    // 运行直到cond成立或者超过timeout，返回cond是否成立
+    bool RunUntil(const std::function<bool()> &cond, std::chrono::microseconds timeout);
+    // term最大的leader，没有时返回-1
+    int Leader();
+
+    std::shared_ptr<Raft> Node(int i) { return m_nodes[i]; }
+    SimNetwork &Network() { return m_network; }
+    std::chrono::_V2::system_clock::time_point Now() { return m_clock->Now(); }
+    void SetApplyCallback(ApplyCallback cb) { m_applyCallback = std::move(cb); }
+
+private:
+    SimOptions m_options;
+    std::shared_ptr<SimClock> m_clock;
+    SimNetwork m_network;
+    std::shared_ptr<PersistSyncer> m_syncer;
+    std::vector<std::shared_ptr<LockQueue<ApplyMsg>>> m_applyChs;
+    std::vector<std::shared_ptr<Raft>> m_nodes;
+    std::chrono::_V2::system_clock::time_point m_nextTick;
+    ApplyCallback m_applyCallback;
+
+    // 推进到下一个到期时刻，到了tick时间就驱动各节点，返回是否执行了tick
+    bool step();
+};
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef RAFTWAL_H
+#define RAFTWAL_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../../raftRpcProto/include/raftRPC.pb.h"
+
+/**
+ * 分段、只追加的预写日志（WAL），用来代替每次persist都整体重写的文本文件
+ * 目录下的每个段文件以递增序号命名（%016llu.wal），只在最后一个段（活跃段）尾部追加新的LogEntry，
+ * 活跃段超过WAL_SEGMENT_MAX_BYTES后滚动到新段；
+ * 快照压缩之后，整段都已被快照覆盖的段文件直接删除，不需要改写任何数据。
+ *
+ * 单条记录格式（本机字节序）：
+ * [uint32 commandLen][uint32 checksum][int32 logIndex][int32 logTerm][command]
+ * checksum覆盖logIndex、logTerm和command，用于在重启时识别写了一半的尾部记录
+ * commandLen的高8位是日志类型（EntryType），所以单条command最长16MB
+ */
+class RaftWal {
+public:
+    explicit RaftWal(const std::string &dir);
+    ~RaftWal();
+
+    // 追加日志，entries的logIndex必须紧接着WAL中最后一条日志
+    // 磁盘写失败对raft来说无法恢复，直接断言退出
+    void Append(const raftRpcProto::LogEntry &entry);
+    void Append(const std::vector<raftRpcProto::LogEntry> &entries);
+    // 删除logIndex >= fromIndex的所有日志（follower日志冲突时使用）
+    void TruncateSuffix(int fromIndex);
+    // 删除所有日志都 <= lastIncludedIndex 的段，被快照完全覆盖的段不再需要
+    void CompactTo(int lastIncludedIndex);
+    // 清空所有段
+    void Reset();
+    // 按顺序读出WAL中所有的日志
+    std::vector<raftRpcProto::LogEntry> ReadAll();
+
+    // WAL中第一条/最后一条日志的logIndex，为空时返回-1
+    int FirstIndex() const;
+    int LastIndex() const;
+    // 所有段文件的总字节数
+    long long SizeBytes() const;
+    // 一条日志编码成记录后的字节数
+    static long long RecordSize(const raftRpcProto::LogEntry &entry);
+    // 复制一份活跃段的文件描述符，供落盘线程在不持有WAL锁的情况下fdatasync
+    // 已滚动出去的段在滚动时就已经落盘
+    int DupActiveFd() const;
+
+private:
+    struct Segment
+    {
+        uint64_t seq;
+        std::string path;
+        // 段内第一条日志的logIndex，空段为-1
+        int firstIndex;
+        int lastIndex;
+        // 每条记录在文件中的起始偏移，用于按logIndex截断
+        std::vector<long long> offsets;
+        long long size;
+    };
+
+    std::string m_dir;
+    std::vector<Segment> m_segments;
+    // 活跃段（m_segments.back()）的文件描述符
+    int m_activeFd;
+
+    void recover();
+    // 扫描段文件，校验并统计其中的记录；entries不为空时顺便解码出日志
+    // 返回false表示文件尾部存在不完整或校验失败的记录
+    bool scanSegment(Segment *seg, std::vector<raftRpcProto::LogEntry> *entries = nullptr) const;
+    // 打开（必要时创建）活跃段，并让目录项落盘
+    void openActive();
+    void rollSegment();
+    void removeSegment(const Segment &seg);
+    // 段文件的创建和删除只有目录fsync之后才不会在断电时丢失或复活
+    void syncDir();
+    std::string segmentPath(uint64_t seq) const;
+    // 将一段已经编码好的记录写入活跃段
+    void writeActive(const std::string &buf);
+    static void encodeRecord(const raftRpcProto::LogEntry &entry, std::string *buf);
+    static uint32_t checksum(const char *data, size_t len);
+};
+
+#endif
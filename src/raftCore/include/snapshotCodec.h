@@ -0,0 +1,53 @@
+#ifndef SNAPSHOTCODEC_H
+#define SNAPSHOTCODEC_H
+
+#include <cstdint>
+#include <string>
+
+// 快照压缩算法，写在快照头部，读取时按头部自动识别
+enum SnapshotCompression
+{
+    SnapshotCompressNone = 0,
+    // 速度优先
+    SnapshotCompressLz4 = 1,
+    // 压缩率优先
+    SnapshotCompressZstd = 2,
+};
+
+/**
+ * 快照的存储和传输格式：
+ * [uint32 magic][uint8 compression][uint8 reserved * 3][uint64 rawSize][压缩后的快照]
+ * 本机字节序。Persister::Save时编码，ReadSnapshot时解码，
+ * leader分块发送的就是编码后的文件内容，网络上传输的也是压缩后的数据。
+ * 没有头部的数据按未压缩的旧格式处理。
+ * LZ4和zstd在编译时检测到头文件才启用，没有启用的算法编码时退回不压缩，
+ * 进程启动时由WarnIfUnsupported在标准错误上提示一次
+ */
+class SnapshotCodec {
+public:
+    static constexpr uint32_t kMagic = 0x4e534652; // "RFSN"
+    static constexpr size_t kHeaderSize = 16;
+
+    static std::string Encode(const std::string &raw, int compression);
+    // 数据损坏或者压缩算法没有编译进来时返回false
+    static bool Decode(const std::string &data, std::string *raw);
+    // 该算法是否可用
+    static bool Supported(int compression);
+    // 配置的算法没有编译进来时向标准错误输出一次提示（不受Debug开关影响），同一进程只提示一次
+    static void WarnIfUnsupported(int compression);
+
+private:
+    struct Codec
+    {
+        // 压缩后长度的上界
+        size_t (*bound)(size_t rawSize);
+        // 返回压缩后的长度，失败返回0
+        size_t (*compress)(const char *src, size_t srcSize, char *dst, size_t dstCapacity);
+        // 解压出恰好rawSize字节时返回true
+        bool (*decompress)(const char *src, size_t srcSize, char *dst, size_t rawSize);
+    };
+
+    static const Codec *findCodec(int compression);
+};
+
+#endif
@@ -0,0 +1,183 @@
+#include "include/multiRaft.h"
+#include "../common/include/config.h"
+#include "../common/include/util.h"
+
+MultiRaft::MultiRaft(int me, std::vector<std::shared_ptr<RaftRpcUtil>> peers)
+    : m_me(me),
+      m_peers(peers),
+      m_syncer(std::make_shared<PersistSyncer>()),
+      m_heartBeatCoalescer(peers),
+      m_groupList(std::make_shared<const std::vector<std::shared_ptr<Raft>>>()),
+      m_stop(false)
+{
+    m_tickThread = std::thread(&MultiRaft::tickLoop, this);
+}
+
+MultiRaft::~MultiRaft()
+{
+    // 先停止各组，它们还在合并队列中的心跳要靠定时线程发出
+    std::vector<std::shared_ptr<Raft>> groups;
+    {
+        std::lock_guard<std::mutex> lg(m_mtx);
+        for (auto &group : m_groups)
+            groups.push_back(group.second);
+    }
+    for (auto &raft : groups)
+        raft->Shutdown();
+
+    m_stop = true;
+    if (m_tickThread.joinable())
+        m_tickThread.join();
+    m_heartBeatCoalescer.Stop();
+}
+
+std::shared_ptr<Raft> MultiRaft::AddGroup(int groupId, std::shared_ptr<LockQueue<ApplyMsg>> applyCh)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    auto it = m_groups.find(groupId);
+    if (it != m_groups.end())
+        return it->second;
+
+    // 文件名带上组号，同一进程中的各组互不覆盖
+    auto persister = std::make_shared<Persister>(std::to_string(groupId) + "_" + std::to_string(m_me), m_syncer);
+    auto raft = std::make_shared<Raft>();
+    raft->initGroup(groupId, m_peers, m_me, persister, applyCh, &m_heartBeatCoalescer);
+    m_groups[groupId] = raft;
+
+    auto groupList = std::make_shared<std::vector<std::shared_ptr<Raft>>>(*m_groupList);
+    groupList->push_back(raft);
+    m_groupList = groupList;
+    DPrintf("[func-MultiRaft::AddGroup-node{%d}] 添加raft组{%d}，共{%d}个组", m_me, groupId, m_groups.size());
+    return raft;
+}
+
+bool MultiRaft::RemoveGroup(int groupId)
+{
+    std::shared_ptr<Raft> raft;
+    {
+        std::lock_guard<std::mutex> lg(m_mtx);
+        auto it = m_groups.find(groupId);
+        if (it == m_groups.end())
+            return false;
+        raft = it->second;
+        m_groups.erase(it);
+
+        auto groupList = std::make_shared<std::vector<std::shared_ptr<Raft>>>();
+        for (auto &group : *m_groupList)
+        {
+            if (group != raft)
+                groupList->push_back(group);
+        }
+        m_groupList = groupList;
+    }
+    // 新的rpc已经找不到这个组，正在处理中的rpc持有shared_ptr，不受影响
+    raft->Shutdown();
+    DPrintf("[func-MultiRaft::RemoveGroup-node{%d}] 删除raft组{%d}", m_me, groupId);
+    return true;
+}
+
+std::shared_ptr<Raft> MultiRaft::GetGroup(int groupId)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    auto it = m_groups.find(groupId);
+    return it == m_groups.end() ? nullptr : it->second;
+}
+
+std::shared_ptr<Raft> MultiRaft::findGroup(google::protobuf::RpcController *controller, int groupId)
+{
+    auto raft = GetGroup(groupId);
+    if (raft == nullptr)
+        controller->SetFailed("unknown raft group " + std::to_string(groupId));
+    return raft;
+}
+
+void MultiRaft::tickLoop()
+{
+    while (!m_stop)
+    {
+        std::shared_ptr<const std::vector<std::shared_ptr<Raft>>> groupList;
+        {
+            std::lock_guard<std::mutex> lg(m_mtx);
+            groupList = m_groupList;
+        }
+        for (auto &raft : *groupList)
+            raft->tick();
+        // 这一轮各组产生的心跳按目标节点合并发出
+        m_heartBeatCoalescer.Flush();
+        sleepNMilliseconds(MULTI_RAFT_TICK_MS);
+    }
+}
+
+void MultiRaft::AppendEntries(google::protobuf::RpcController *controller,
+                              const ::raftRpcProto::AppendEntriesArgs *request,
+                              ::raftRpcProto::AppendEntriesReply *response, ::google::protobuf::Closure *done)
+{
+    auto raft = findGroup(controller, request->groupid());
+    if (raft != nullptr)
+        raft->AppendEntries(request, response);
+    done->Run();
+}
+
+void MultiRaft::InstallSnapshot(google::protobuf::RpcController *controller,
+                                const ::raftRpcProto::InstallSnapshotRequest *request,
+                                ::raftRpcProto::InstallSnapshotResponse *response, ::google::protobuf::Closure *done)
+{
+    auto raft = findGroup(controller, request->groupid());
+    if (raft != nullptr)
+        raft->InstallSnapshot(request, response);
+    done->Run();
+}
+
+void MultiRaft::RequestVote(google::protobuf::RpcController *controller, const ::raftRpcProto::RequestVoteArgs *request,
+                            ::raftRpcProto::RequestVoteReply *response, ::google::protobuf::Closure *done)
+{
+    auto raft = findGroup(controller, request->groupid());
+    if (raft != nullptr)
+        raft->RequestVote(request, response);
+    done->Run();
+}
+
+void MultiRaft::ReadIndex(google::protobuf::RpcController *controller, const ::raftRpcProto::ReadIndexArgs *request,
+                          ::raftRpcProto::ReadIndexReply *response, ::google::protobuf::Closure *done)
+{
+    auto raft = findGroup(controller, request->groupid());
+    if (raft != nullptr)
+        raft->ReadIndex(request, response);
+    done->Run();
+}
+
+void MultiRaft::TimeoutNow(google::protobuf::RpcController *controller, const ::raftRpcProto::TimeoutNowArgs *request,
+                           ::raftRpcProto::TimeoutNowReply *response, ::google::protobuf::Closure *done)
+{
+    auto raft = findGroup(controller, request->groupid());
+    if (raft != nullptr)
+        raft->TimeoutNow(request, response);
+    done->Run();
+}
+
+void MultiRaft::BatchAppendEntries(google::protobuf::RpcController * /*controller*/,
+                                   const ::raftRpcProto::BatchAppendEntriesArgs *request,
+                                   ::raftRpcProto::BatchAppendEntriesReply *response, ::google::protobuf::Closure *done)
+{
+    // 需要等待落盘的组和它们的落盘序号
+    std::vector<std::pair<std::shared_ptr<Raft>, uint64_t>> durable;
+    for (int i = 0; i < request->args_size(); i++)
+    {
+        const auto &args = request->args(i);
+        auto *reply = response->add_replies();
+        auto raft = GetGroup(args.groupid());
+        if (raft == nullptr)
+        {
+            // 本节点还没有这个组，leader当作这个节点不可达
+            reply->set_appstate(Disconnected);
+            continue;
+        }
+        uint64_t ticket = raft->AppendEntriesDeferSync(&args, reply);
+        if (ticket != 0)
+            durable.emplace_back(raft, ticket);
+    }
+    // 所有组都写完WAL之后再等待，它们的追加进入共享落盘线程的同一批fsync，整个请求只等一次
+    for (auto &group : durable)
+        group.first->WaitDurable(group.second);
+    done->Run();
+}
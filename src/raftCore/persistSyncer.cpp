@@ -0,0 +1,100 @@
+#include "include/persistSyncer.h"
+#include <algorithm>
+#include "include/Persister.h"
+#include "../common/include/config.h"
+#include "../common/include/util.h"
+
+PersistSyncer::PersistSyncer()
+    : m_stop(false),
+      m_pendingAppends(0),
+      m_urgent(false),
+      m_firstPendingTime(now()),
+      m_syncing(nullptr),
+      m_simulated(false),
+      m_syncLatency(0)
+{
+    m_thread = std::thread(&PersistSyncer::syncLoop, this);
+}
+
+PersistSyncer::PersistSyncer(std::chrono::microseconds syncLatency)
+    : m_stop(false),
+      m_pendingAppends(0),
+      m_urgent(false),
+      m_firstPendingTime(now()),
+      m_syncing(nullptr),
+      m_simulated(true),
+      m_syncLatency(syncLatency)
+{
+    m_thread = std::thread(&PersistSyncer::syncLoop, this);
+}
+
+PersistSyncer::~PersistSyncer()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_stop = true;
+        m_cond.notify_all();
+    }
+    if (m_thread.joinable())
+        m_thread.join();
+}
+
+void PersistSyncer::Notify(Persister *persister, bool urgent)
+{
+    std::lock_guard<std::mutex> lock(m_mtx);
+    if (urgent)
+    {
+        m_urgent = true;
+    }
+    else
+    {
+        if (m_pendingAppends == 0)
+            m_firstPendingTime = now();
+        ++m_pendingAppends;
+    }
+    if (std::find(m_pending.begin(), m_pending.end(), persister) == m_pending.end())
+        m_pending.push_back(persister);
+    m_cond.notify_all();
+}
+
+void PersistSyncer::Remove(Persister *persister)
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    m_pending.erase(std::remove(m_pending.begin(), m_pending.end(), persister), m_pending.end());
+    m_batch.erase(std::remove(m_batch.begin(), m_batch.end(), persister), m_batch.end());
+    waitCond(m_cond, lock, [&]() { return m_syncing != persister; });
+}
+
+void PersistSyncer::syncLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    while (!m_stop)
+    {
+        waitCond(m_cond, lock, [&]() { return m_stop || !m_pending.empty(); });
+        if (m_stop)
+            break;
+
+        // 攒批：够PERSIST_BATCH_SIZE次追加，或者最早的追加已经等了PERSIST_MAX_DELAY_US
+        auto deadline = m_firstPendingTime + std::chrono::microseconds(PERSIST_MAX_DELAY_US);
+        waitUntil(m_cond, lock, deadline,
+                  [&]() { return m_stop || m_urgent || m_pendingAppends >= PERSIST_BATCH_SIZE; });
+        m_pendingAppends = 0;
+        m_urgent = false;
+
+        // 落盘期间新到的追加进入下一批
+        m_batch.swap(m_pending);
+        while (!m_batch.empty())
+        {
+            Persister *persister = m_batch.front();
+            m_batch.pop_front();
+            m_syncing = persister;
+            lock.unlock();
+            if (m_simulated)
+                sleepFor(m_syncLatency);
+            persister->syncOnce(!m_simulated);
+            lock.lock();
+            m_syncing = nullptr;
+            m_cond.notify_all();
+        }
+    }
+}
@@ -1,6 +1,8 @@
 #include "include/raft.h"
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
+#include <algorithm>
+#include <climits>
 #include <memory>
 #include "../common/include/config.h"
 #include "../common/include/util.h"
@@ -17,6 +19,7 @@ void Raft::AppendEntriesAnotherVersion(const raftRpcProto::AppendEntriesArgs *ar
         reply->set_success(false);
         reply->set_term(m_currentTerm);
         reply->set_updatenextindex(-100);
+        reply->set_conflictterm(-1);
         DPrintf("Leader{%d}的term{%d} < rf{%d}.term{%d}\n", args->leaderid(), args->term(), m_me, m_currentTerm);
         return;
     }
@@ -28,10 +31,14 @@ void Raft::AppendEntriesAnotherVersion(const raftRpcProto::AppendEntriesArgs *ar
         m_status = Follower;
         m_currentTerm = args->term();
         m_votedFor = -1;
+        m_readCond.notify_all();
+        m_transferCond.notify_all();
     }
     myAssert(args->term() == m_currentTerm, format("assert {args.Term == rf.currentTerm} fail"));
     // 如果发生网络分区，那么candidate可能会收到同一个term的leader的消息，要转变为Follower
     m_status = Follower;
+    refreshProposalGate();
+    m_leaderId = args->leaderid();
     m_lastResetElectionTime = now();
 
     //	比较日志，日志有3种情况
@@ -40,6 +47,7 @@ void Raft::AppendEntriesAnotherVersion(const raftRpcProto::AppendEntriesArgs *ar
         reply->set_success(false);
         reply->set_term(m_currentTerm);
         reply->set_updatenextindex(getLastLogIndex() + 1);
+        reply->set_conflictterm(-1);
         return;
     }
     else if (args->prevlogindex() < m_lastSnapshotIncludeIndex)
@@ -50,6 +58,8 @@ void Raft::AppendEntriesAnotherVersion(const raftRpcProto::AppendEntriesArgs *ar
         reply->set_updatenextindex(
             m_lastSnapshotIncludeIndex +
             1);
+        reply->set_conflictterm(-1);
+        return;
     }
     //	本机日志有那么长，冲突(same index,different term),截断日志
     // 注意：这里目前当args.PrevLogIndex == rf.lastSnapshotIncludeIndex与不等的时候要分开考虑，可以看看能不能优化这块
@@ -60,13 +70,18 @@ void Raft::AppendEntriesAnotherVersion(const raftRpcProto::AppendEntriesArgs *ar
         // 那意思是不是可能会有一段发来的AE中的logs中前半是匹配的，后半是不匹配的，这种应该：1.follower如何处理？ 2.如何给leader回复
         // 3. leader如何处理
 
+        // witness只保存普通日志的term和index，leader一般已经去掉了Command
+        bool witness = m_config.IsWitness(m_me);
         for (int i = 0; i < args->entries_size(); i++)
         {
             auto log = args->entries(i);
+            if (witness && log.type() == raftRpcProto::EntryNormal)
+                log.clear_command();
             if (log.logindex() > getLastLogIndex())
             {
                 // 超过就直接添加日志
                 m_logs.push_back(log);
+                markLogDirty(log.logindex());
             }
             else
             {
@@ -87,8 +102,10 @@ void Raft::AppendEntriesAnotherVersion(const raftRpcProto::AppendEntriesArgs *ar
                 }
                 if (m_logs[getSlicesIndexFromLogIndex(log.logindex())].logterm() != log.logterm())
                 {
-                    // 不匹配就更新
-                    m_logs[getSlicesIndexFromLogIndex(log.logindex())] = log;
+                    // 冲突：这一条之后的旧日志也都和leader不一致，全部截掉再追加，保证日志的term单调不减
+                    truncateLogSuffix(log.logindex());
+                    m_logs.push_back(log);
+                    markLogDirty(log.logindex());
                 }
             }
         }
@@ -106,7 +123,11 @@ void Raft::AppendEntriesAnotherVersion(const raftRpcProto::AppendEntriesArgs *ar
         // }
         if (args->leadercommit() > m_commitIndex)
         {
-            m_commitIndex = std::min(args->leadercommit(), getLastLogIndex());
+            // 只能提交到本次请求确认过的位置：流水线下leader会从matchIndex发空心跳，
+            // prevLogIndex之后可能还有与leader不一致的旧日志
+            int newCommitIndex = std::min(args->leadercommit(), args->prevlogindex() + args->entries_size());
+            if (newCommitIndex > m_commitIndex)
+                advanceCommitIndex(newCommitIndex);
             // 这个地方不能无脑跟上getLastLogIndex()，因为可能存在args->leadercommit()落后于 getLastLogIndex()的情况
         }
 
@@ -125,23 +146,13 @@ void Raft::AppendEntriesAnotherVersion(const raftRpcProto::AppendEntriesArgs *ar
     }
     else
     {
-        // 优化
-        // PrevLogIndex 长度合适，但是不匹配，因此往前寻找 矛盾的term的第一个元素
-        // 为什么该term的日志都是矛盾的呢？也不一定都是矛盾的，只是这么优化减少rpc而已
-        // ？什么时候term会矛盾呢？很多情况，比如leader接收了日志之后马上就崩溃等等
-        reply->set_updatenextindex(args->prevlogindex());
-
-        for (int index = args->prevlogindex(); index >= m_lastSnapshotIncludeIndex; --index)
-        {
-            if (getLogTermFromLogIndex(index) != getLogTermFromLogIndex(args->prevlogindex()))
-            {
-                reply->set_updatenextindex(index + 1);
-                break;
-            }
-        }
+        // PrevLogIndex 长度合适，但是不匹配：把自己在PrevLogIndex处的term和这个term的第一条日志告诉leader，
+        // leader可以一次跳过整个冲突的term，回退的rpc次数和term数相关，而不是和日志条数相关
+        int conflictTerm = getLogTermFromLogIndex(args->prevlogindex());
+        reply->set_conflictterm(conflictTerm);
+        reply->set_updatenextindex(getFirstLogIndexOfTerm(conflictTerm, args->prevlogindex()));
         reply->set_success(false);
         reply->set_term(m_currentTerm);
-        // 对UpdateNextIndex待优化  todo  找到符合的term的最后一个
         //        DPrintf("[func-AppendEntries-rf{%v}]
         //        拒绝了节点{%v}，因为prevLodIndex{%v}的args.term{%v}不匹配当前节点的logterm{%v}，返回值：{%v}\n",
         //                rf.me, args.LeaderId, args.PrevLogIndex, args.PrevLogTerm,
@@ -155,69 +166,2110 @@ void Raft::AppendEntriesAnotherVersion(const raftRpcProto::AppendEntriesArgs *ar
     // fmt.Printf("[func-AppendEntries,rf{%v}]:len(rf.logs):%v, rf.commitIndex:%v\n", rf.me, len(rf.logs), rf.commitIndex)
 }
 
-    std::lock_guard<std::mutex> locker(m_mtx);
+// commitIndex推进时被唤醒，一次取走所有新提交的日志，锁外交给上层状态机
+void Raft::applierTicker()
+{
+    while (true)
+    {
+        std::vector<ApplyMsg> applyMsgs;
+        {
+            std::unique_lock<std::mutex> lock(m_mtx);
+            waitCond(m_applyCond, lock, [&]() { return hasApplyWork(); });
+            applyMsgs = getApplyLogs();
+            // 等待m_lastApplied的ReadIndex读可以继续了
+            m_readCond.notify_all();
+        }
+        if (!applyMsgs.empty())
+            DPrintf("[func- Raft::applierTicker()-raft{%d}] 向kvserver报告的applyMsgs长度为：{%d}", m_me, applyMsgs.size());
+        for (auto &message : applyMsgs)
+            applyChan->Push(message);
+    }
+}
 
-    // 能到这一步就表示网络是正常的
-    reply->set_appstate(AppNormal);
+// 调用前需要持有m_mtx
+bool Raft::hasApplyWork()
+{
+    return m_lastApplied < m_commitIndex || m_pendingSnapshotMsg != nullptr;
+}
 
-    // 收到Leader回复中的term值比自己小，此时Leader过期，拒绝该请求
-    if (args->term() < m_currentTerm) {
-        reply->set_success(false);
+std::vector<ApplyMsg> Raft::getApplyLogs()
+{
+    std::vector<ApplyMsg> applyMsgs;
+    // 快照之后的日志要在快照之后交给上层，所以快照和日志由同一个线程按顺序发出
+    if (m_pendingSnapshotMsg != nullptr)
+    {
+        applyMsgs.emplace_back(std::move(*m_pendingSnapshotMsg));
+        m_pendingSnapshotMsg = nullptr;
+    }
+    myAssert(m_commitIndex <= getLastLogIndex(), format("[func-getApplyLogs-rf{%d}] commitIndex{%d} >getLastLogIndex{%d}",
+                                                        m_me, m_commitIndex, getLastLogIndex()));
+    if (m_config.IsWitness(m_me))
+    {
+        // witness没有状态机，已提交的日志只需要定期压缩
+        m_lastApplied = m_commitIndex;
+        if (m_lastApplied - m_lastSnapshotIncludeIndex >= WITNESS_LOG_COMPACT_ENTRIES)
+            compactLog(m_lastApplied, "");
+        return applyMsgs;
+    }
+    applyMsgs.reserve(m_commitIndex - m_lastApplied);
+    while (m_lastApplied < m_commitIndex)
+    {
+        m_lastApplied++;
+        const auto &entry = m_logs[getSlicesIndexFromLogIndex(m_lastApplied)];
+        ApplyMsg applyMsg;
+        // 成员变更在提交时已经生效，只把index告诉上层
+        applyMsg.CommandValid = entry.type() == raftRpcProto::EntryNormal;
+        applyMsg.SnapshotValid = false;
+        if (applyMsg.CommandValid)
+            applyMsg.Command = entry.command();
+        applyMsg.CommandIndex = m_lastApplied;
+        applyMsgs.emplace_back(std::move(applyMsg));
+    }
+    return applyMsgs;
+}
+
+// 只写有变化的部分：硬状态变了才重写raftState，日志只把新追加或被覆盖的部分写入WAL
+void Raft::persist()
+{
+    persistHardState();
+    persistLog();
+}
+
+RaftPersistHeader Raft::hardState()
+{
+    RaftPersistHeader header;
+    header.currentTerm = m_currentTerm;
+    header.votedFor = m_votedFor;
+    header.commitIndex = m_commitIndex;
+    header.lastSnapshotIncludeIndex = m_lastSnapshotIncludeIndex;
+    header.lastSnapshotIncludeTerm = m_lastSnapshotIncludeTerm;
+    header.config = m_config.Encode();
+    return header;
+}
+
+// SaveRaftState每次都要落盘，只有term、投票、快照位置或成员配置变化时才重写。
+// commitIndex只在这时顺带写入：它落后只会让重启后多重放一些日志，不值得每次提交都fsync一次
+void Raft::persistHardState()
+{
+    RaftPersistHeader header = hardState();
+    RaftPersistHeader unchanged = header;
+    unchanged.commitIndex = m_persistedHardState.commitIndex;
+    if (unchanged == m_persistedHardState)
+        return;
+    m_persister->SaveRaftState(RaftStateCodec::Encode(header));
+    m_persistedHardState = header;
+}
+
+// 把m_logDirtyFrom之后的日志写入WAL，返回本次追加在Persister中的落盘序号
+uint64_t Raft::persistLog()
+{
+    if (m_logDirtyFrom == INT_MAX)
+        return m_persister->LastAppendTicket();
+
+    int lastLogIndex = getLastLogIndex();
+    int from = std::max(m_logDirtyFrom, m_lastSnapshotIncludeIndex + 1);
+    if (m_walLastIndex != -1 && m_walLastIndex < from - 1)
+    {
+        // 安装快照之后日志不再连续，WAL中的旧日志全部作废
+        m_persister->CompactLog(from - 1);
+    }
+    else if (from <= m_walLastIndex)
+    {
+        // 被覆盖的日志从WAL中截掉再重新追加
+        m_persister->TruncateLog(from);
+    }
+
+    std::vector<raftRpcProto::LogEntry> entries;
+    for (int index = from; index <= lastLogIndex; ++index)
+        entries.push_back(m_logs[getSlicesIndexFromLogIndex(index)]);
+    m_walLastIndex = lastLogIndex;
+    m_logDirtyFrom = INT_MAX;
+    return m_persister->AppendLog(entries);
+}
+
+void Raft::markLogDirty(int logIndex)
+{
+    m_logDirtyFrom = std::min(m_logDirtyFrom, logIndex);
+}
+
+// 调用前需要持有m_mtx
+// 删除fromIndex及之后的日志，WAL在下一次persistLog时从fromIndex截断
+void Raft::truncateLogSuffix(int fromIndex)
+{
+    myAssert(fromIndex > m_commitIndex,
+             format("[func-truncateLogSuffix-rf{%d}] 要截断的logIndex{%d}已经提交，commitIndex{%d}", m_me, fromIndex,
+                    m_commitIndex));
+    m_logs.truncateSuffix(getSlicesIndexFromLogIndex(fromIndex));
+    markLogDirty(fromIndex);
+    // 之后在这些位置追加的日志还没有落盘，当选leader后不能把自己算进它们的多数派
+    m_persistedLogIndex = std::min(m_persistedLogIndex, fromIndex - 1);
+}
+
+// 只有硬状态，日志在WAL中
+std::string Raft::persistData()
+{
+    return RaftStateCodec::Encode(hardState());
+}
+
+void Raft::readPersist(std::string data)
+{
+    if (data.empty())
+        return;
+
+    RaftPersistHeader header;
+    m_logs.clear();
+    if (!RaftStateCodec::Decode(data, &header, &m_logs))
+    {
+        DPrintf("[func-Raft::readPersist-raft{%d}] 持久化数据格式错误，忽略", m_me);
+        m_logs.clear();
+        return;
+    }
+    m_currentTerm = header.currentTerm;
+    m_votedFor = header.votedFor;
+    m_lastSnapshotIncludeIndex = header.lastSnapshotIncludeIndex;
+    m_lastSnapshotIncludeTerm = header.lastSnapshotIncludeTerm;
+    m_commitIndex = std::max(header.commitIndex, m_lastSnapshotIncludeIndex);
+    // 旧版本的持久化数据没有配置，沿用启动配置
+    if (!header.config.empty() && !RaftConfig::Decode(header.config, &m_config))
+        DPrintf("[func-Raft::readPersist-raft{%d}] 成员配置格式错误，沿用启动配置", m_me);
+    m_persistedHardState = header;
+
+    // 日志直接从WAL解码，快照之前的部分跳过
+    for (auto &entry : m_persister->ReadLog())
+    {
+        if (entry.logindex() > m_lastSnapshotIncludeIndex)
+            m_logs.push_back(std::move(entry));
+    }
+    m_walLastIndex = m_logs.empty() ? -1 : m_logs.back().logindex();
+    m_logDirtyFrom = INT_MAX;
+    m_persistedLogIndex = getLastLogIndex();
+}
+
+void Raft::electionTimeOutTicker()
+{
+    while (true)
+    {
+        // leader不需要选举
+        while (m_status == Leader)
+            sleepNMilliseconds(HeartBeatTimeout);
+
+        std::chrono::nanoseconds suitableSleepTime{};
+        std::chrono::_V2::system_clock::time_point wakeTime{};
+        {
+            std::lock_guard<std::mutex> lock(m_mtx);
+            wakeTime = now();
+            suitableSleepTime = getRandomizedElectionTimeout() + m_lastResetElectionTime - wakeTime;
+        }
+        if (std::chrono::duration<double, std::milli>(suitableSleepTime).count() > 1)
+            sleepFor(std::chrono::duration_cast<std::chrono::microseconds>(suitableSleepTime));
+
+        // 睡眠期间选举时间被重置过（收到了leader的消息或者投出了票），重新计时
+        if (std::chrono::duration<double, std::milli>(m_lastResetElectionTime - wakeTime).count() > 0)
+            continue;
+        doElection();
+    }
+}
+
+// 预投票：用m_currentTerm + 1询问其他节点是否会投票，不修改自己的term
+// 重新接入的分区节点拿不到多数同意，就不会抬高term把正常的leader拉下来
+void Raft::doElection()
+{
+    std::lock_guard<std::mutex> g(m_mtx);
+    if (m_status == Leader)
+        return;
+    // 选举超时，认为leader已经失联
+    m_leaderId = -1;
+    m_lastResetElectionTime = now();
+    // learner、witness和还不知道配置的新节点不发起选举，witness没有数据，不能当leader
+    if (!m_config.IsVoter(m_me) || m_config.IsWitness(m_me))
+        return;
+
+    // 自己算一票
+    auto votes = std::make_shared<std::set<int>>();
+    votes->insert(m_me);
+    if (m_config.HasQuorum([&](int id) { return votes->count(id) > 0; }))
+    {
+        startElection();
+        return;
+    }
+    int lastLogIndex = -1;
+    int lastLogTerm = -1;
+    getLastLogIndexAndTerm(&lastLogIndex, &lastLogTerm);
+    DPrintf("[func-doElection-rf{%d}] 选举定时器到期，发起term{%d}的预投票", m_me, m_currentTerm + 1);
+    for (int i : m_config.Members())
+    {
+        if (i == m_me || !m_config.IsVoter(i) || m_peers[i] == nullptr)
+            continue;
+        auto requestVoteArgs = std::make_shared<raftRpcProto::RequestVoteArgs>();
+        requestVoteArgs->set_term(m_currentTerm + 1);
+        requestVoteArgs->set_candidateid(m_me);
+        requestVoteArgs->set_lastlogindex(lastLogIndex);
+        requestVoteArgs->set_lastlogterm(lastLogTerm);
+        requestVoteArgs->set_prevote(true);
+        requestVoteArgs->set_groupid(m_groupId);
+        auto requestVoteReply = std::make_shared<raftRpcProto::RequestVoteReply>();
+        std::shared_ptr<RaftRpcUtil> peer = m_peers[i];
+        spawnTask([this, i, peer, requestVoteArgs, requestVoteReply, votes]()
+                  { sendRequestVote(i, peer, requestVoteArgs, requestVoteReply, votes); });
+    }
+}
+
+// 调用前需要持有m_mtx
+// 预投票通过后才真正成为candidate并增加term
+void Raft::startElection()
+{
+    m_status = Candidate;
+    m_currentTerm += 1;
+    m_votedFor = m_me;
+    m_leaderId = -1;
+    refreshProposalGate();
+    persist();
+    m_readCond.notify_all();
+    m_lastResetElectionTime = now();
+
+    auto votes = std::make_shared<std::set<int>>();
+    votes->insert(m_me);
+    if (m_config.HasQuorum([&](int id) { return votes->count(id) > 0; }))
+    {
+        becomeLeader();
+        return;
+    }
+    int lastLogIndex = -1;
+    int lastLogTerm = -1;
+    getLastLogIndexAndTerm(&lastLogIndex, &lastLogTerm);
+    DPrintf("[func-startElection-rf{%d}] 预投票通过，开始term{%d}的选举", m_me, m_currentTerm);
+    for (int i : m_config.Members())
+    {
+        if (i == m_me || !m_config.IsVoter(i) || m_peers[i] == nullptr)
+            continue;
+        auto requestVoteArgs = std::make_shared<raftRpcProto::RequestVoteArgs>();
+        requestVoteArgs->set_term(m_currentTerm);
+        requestVoteArgs->set_candidateid(m_me);
+        requestVoteArgs->set_lastlogindex(lastLogIndex);
+        requestVoteArgs->set_lastlogterm(lastLogTerm);
+        requestVoteArgs->set_prevote(false);
+        requestVoteArgs->set_groupid(m_groupId);
+        auto requestVoteReply = std::make_shared<raftRpcProto::RequestVoteReply>();
+        std::shared_ptr<RaftRpcUtil> peer = m_peers[i];
+        spawnTask([this, i, peer, requestVoteArgs, requestVoteReply, votes]()
+                  { sendRequestVote(i, peer, requestVoteArgs, requestVoteReply, votes); });
+    }
+}
+
+// 调用前需要持有m_mtx
+void Raft::becomeLeader()
+{
+    DPrintf("[func-becomeLeader-rf{%d}] 成为term{%d}的leader，lastLogIndex{%d}", m_me, m_currentTerm, getLastLogIndex());
+    m_status = Leader;
+    m_leaderId = m_me;
+    int lastLogIndex = getLastLogIndex();
+    for (int i = 0; i < static_cast<int>(m_peers.size()); i++)
+    {
+        m_nextIndex[i] = lastLogIndex + 1;
+        m_matchIndex[i] = 0;
+        resetInflight(i);
+        m_progressState[i] = ProgressProbe;
+        // 之前任期的确认不能用来证明这一任期的身份
+        m_peerAckRound[i] = 0;
+    }
+    m_readRoundStartTime.clear();
+    m_leadTransferee = -1;
+    refreshProposalGate();
+    // 上一任leader可能留下了没提交的成员变更，它提交之前不能发起新的变更
+    m_pendingConfIndex = 0;
+    for (int index = m_commitIndex + 1; index <= lastLogIndex; index++)
+    {
+        if (m_logs[getSlicesIndexFromLogIndex(index)].type() == raftRpcProto::EntryConfChange)
+            m_pendingConfIndex = index;
+    }
+    broadcastHeartBeat();
+    // 上一任leader在过渡配置提交之后、离开之前退位了
+    if (m_config.Joint() && m_pendingConfIndex <= m_commitIndex)
+    {
+        raftRpcProto::ConfChange cc;
+        cc.set_type(raftRpcProto::ConfLeaveJoint);
+        proposeConfChange(cc);
+    }
+}
+
+bool Raft::sendRequestVote(int server, std::shared_ptr<RaftRpcUtil> peer,
+                           std::shared_ptr<raftRpcProto::RequestVoteArgs> args,
+                           std::shared_ptr<raftRpcProto::RequestVoteReply> reply, std::shared_ptr<std::set<int>> votes)
+{
+    bool ok = peer->RequestVote(args.get(), reply.get());
+    if (!ok)
+        return ok;
+
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (reply->term() > m_currentTerm)
+    {
+        m_status = Follower;
+        m_currentTerm = reply->term();
+        m_votedFor = -1;
+        m_leaderId = -1;
+        persist();
+        m_readCond.notify_all();
+        m_transferCond.notify_all();
+        refreshProposalGate();
+        return ok;
+    }
+
+    if (args->prevote())
+    {
+        // 预投票期间可能已经收到了leader的消息，或者这一轮已经过期
+        if (m_status == Leader || m_leaderId != -1 || args->term() != m_currentTerm + 1 || !reply->votegranted())
+            return ok;
+        votes->insert(server);
+        if (m_config.HasQuorum([&](int id) { return votes->count(id) > 0; }))
+        {
+            // 只触发一次
+            votes->clear();
+            startElection();
+        }
+        return ok;
+    }
+
+    if (m_status != Candidate || args->term() != m_currentTerm)
+        return ok;
+    myAssert(reply->term() == m_currentTerm,
+             format("assert {reply.Term==rf.currentTerm} fail, reply.Term{%d}, rf.currentTerm{%d}", reply->term(),
+                    m_currentTerm));
+    if (!reply->votegranted())
+        return ok;
+    votes->insert(server);
+    if (m_config.HasQuorum([&](int id) { return votes->count(id) > 0; }))
+    {
+        votes->clear();
+        becomeLeader();
+    }
+    return ok;
+}
+
+void Raft::RequestVote(const raftRpcProto::RequestVoteArgs *args, raftRpcProto::RequestVoteReply *reply)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    reply->set_prevote(args->prevote());
+
+    if (args->prevote())
+    {
+        // 预投票不修改term和votedFor，也不重置选举时间
         reply->set_term(m_currentTerm);
-        reply->set_updatenextindex(-100);
-        DPrintf("Leader{%d}的term = %d < 当前节点{%d}的term = %d， 拒绝该请求", args->leaderid(), args->term(), m_me, m_currentTerm);
+        // 最近收到过leader的消息，说明leader还活着，不支持对方发起选举
+        bool leaderAlive = m_status == Leader ||
+                           (m_leaderId != -1 &&
+                            now() - m_lastResetElectionTime < std::chrono::milliseconds(minRandomizedElectionTime));
+        if (args->term() <= m_currentTerm || leaderAlive)
+        {
+            reply->set_votestate(Expire);
+            reply->set_votegranted(false);
+            return;
+        }
+        if (!UpToDate(args->lastlogindex(), args->lastlogterm()))
+        {
+            reply->set_votestate(Voted);
+            reply->set_votegranted(false);
+            return;
+        }
+        reply->set_votestate(Normal);
+        reply->set_votegranted(true);
         return;
     }
 
     DEFER { persist(); };
-
-    // 收到Leader回复中的term值比自己大
-    if (args->term() > m_currentTerm) {
+    // 对方的term更小，拒绝
+    if (args->term() < m_currentTerm)
+    {
+        reply->set_term(m_currentTerm);
+        reply->set_votestate(Expire);
+        reply->set_votegranted(false);
+        return;
+    }
+    // 对方的term更大，不管是否投票都要退回follower
+    if (args->term() > m_currentTerm)
+    {
         m_status = Follower;
         m_currentTerm = args->term();
         m_votedFor = -1;
+        m_leaderId = -1;
+        m_readCond.notify_all();
+        m_transferCond.notify_all();
+        refreshProposalGate();
     }
-    myAssert(args->term() == m_currentTerm, format("args.term != rf.currentTerm"));
-    m_status = Follower;
-    m_lastResetElectionTime = now();
+    myAssert(args->term() == m_currentTerm,
+             format("[func--rf{%d}] 前面校验过args.Term==rf.currentTerm，这里却不等", m_me));
 
-    if (args->prevlogindex() > getLastLogIndex()) {
-        reply->set_success(false);
+    // 对方的日志不比自己新，拒绝
+    if (!UpToDate(args->lastlogindex(), args->lastlogterm()))
+    {
+        reply->set_term(m_currentTerm);
+        reply->set_votestate(Voted);
+        reply->set_votegranted(false);
+        return;
+    }
+    // 这一任期已经投给了别人
+    if (m_votedFor != -1 && m_votedFor != args->candidateid())
+    {
         reply->set_term(m_currentTerm);
-        reply->set_updatenextindex(m_lastSnapshotIncludeIndex + 1);
+        reply->set_votestate(Voted);
+        reply->set_votegranted(false);
+        return;
     }
+    m_votedFor = args->candidateid();
+    // 投出票之后才重置选举时间
+    m_lastResetElectionTime = now();
+    reply->set_term(m_currentTerm);
+    reply->set_votestate(Normal);
+    reply->set_votegranted(true);
+}
 
-    if (matchLog(args->prevlogindex(), args->prevlogterm())) {
-        for (int i = 0; i < args->entries_size(); i++)
+// 候选者的日志至少和自己一样新
+bool Raft::UpToDate(int index, int term)
+{
+    int lastIndex = -1;
+    int lastTerm = -1;
+    getLastLogIndexAndTerm(&lastIndex, &lastTerm);
+    return term > lastTerm || (term == lastTerm && index >= lastIndex);
+}
+
+void Raft::RequestVote(google::protobuf::RpcController * /*controller*/, const ::raftRpcProto::RequestVoteArgs *request,
+                       ::raftRpcProto::RequestVoteReply *response, ::google::protobuf::Closure *done)
+{
+    RequestVote(request, response);
+    done->Run();
+}
+
+void Raft::leaderHearBeatTicker()
+{
+    while (true)
+    {
+        // 不是leader时不发心跳
+        while (m_status != Leader)
+            sleepNMilliseconds(HeartBeatTimeout);
+
+        std::chrono::nanoseconds suitableSleepTime{};
+        std::chrono::_V2::system_clock::time_point wakeTime{};
         {
-            auto log = args->entries(i);
-            if (log.logindex() > getLastLogIndex())
+            std::lock_guard<std::mutex> lock(m_mtx);
+            wakeTime = now();
+            suitableSleepTime = std::chrono::milliseconds(HeartBeatTimeout) + m_lastResetHearBeatTime - wakeTime;
+        }
+        if (std::chrono::duration<double, std::milli>(suitableSleepTime).count() > 1)
+            sleepFor(std::chrono::duration_cast<std::chrono::microseconds>(suitableSleepTime));
+
+        // 睡眠期间心跳时间被重置过，说明已经发过心跳了
+        if (std::chrono::duration<double, std::milli>(m_lastResetHearBeatTime - wakeTime).count() > 0)
+            continue;
+        doHeartBeat();
+    }
+}
+
+void Raft::doHeartBeat()
+{
+    std::lock_guard<std::mutex> g(m_mtx);
+    if (m_status != Leader)
+        return;
+    if (m_leadTransferee != -1 && now() >= m_leadTransferDeadline)
+    {
+        // 目标节点没能在期限内当选，放弃转移
+        DPrintf("[func-doHeartBeat-rf{%d}] 向节点{%d}的领导权转移超时，恢复接受日志", m_me, m_leadTransferee);
+        m_leadTransferee = -1;
+        refreshProposalGate();
+    }
+    broadcastHeartBeat();
+}
+
+// 调用前需要持有m_mtx
+// 每次广播都是一个新的ReadIndex确认轮次
+void Raft::broadcastHeartBeat()
+{
+    ++m_readRoundSeq;
+    for (int i = 0; i < static_cast<int>(m_peers.size()); i++)
+    {
+        if (i == m_me || !m_config.Contains(i))
+            continue;
+        leaderSendAppendEntries(i, true);
+    }
+    m_lastResetHearBeatTime = now();
+    m_readRoundStartTime[m_readRoundSeq] = m_lastResetHearBeatTime;
+}
+
+// 调用前需要持有m_mtx
+// heartBeat为false时只在有新日志且窗口未满时发送
+void Raft::leaderSendAppendEntries(int server, bool heartBeat)
+{
+    // 还不知道地址的节点
+    if (m_peers[server] == nullptr || m_shutdown)
+        return;
+    // 快照发送线程结束时会回到探测状态
+    if (m_progressState[server] == ProgressSnapshot)
+        return;
+
+    // 很久没有收到在途请求的回复，认为它们已经丢失，从matchIndex之后重新探测
+    if (m_inflightCount[server] > 0 &&
+        now() - m_inflightProgressTime[server] > std::chrono::milliseconds(minRandomizedElectionTime))
+    {
+        // 已经处于探测状态时becomeProgress直接返回，窗口必须在这里清空，否则丢失的探测会让它一直卡住
+        resetInflight(server);
+        becomeProgress(server, ProgressProbe);
+        m_nextIndex[server] = m_matchIndex[server] + 1;
+    }
+    if (m_nextIndex[server] <= m_lastSnapshotIncludeIndex)
+    {
+        // 需要的日志已经被快照了
+        becomeProgress(server, ProgressSnapshot);
+        spawnTask([this, server]() { leaderSendSnapShot(server); });
+        return;
+    }
+
+    int lastLogIndex = getLastLogIndex();
+    bool probe = m_progressState[server] == ProgressProbe;
+    bool hasNewEntries = m_nextIndex[server] <= lastLogIndex;
+    bool windowFull = m_inflightCount[server] >= (probe ? 1 : APPEND_INFLIGHT_MAX) ||
+                      m_inflightBytes[server] >= APPEND_INFLIGHT_MAX_BYTES;
+    if (!heartBeat && (!hasNewEntries || windowFull))
+        return;
+
+    auto appendEntriesArgs = std::make_shared<raftRpcProto::AppendEntriesArgs>();
+    appendEntriesArgs->set_term(m_currentTerm);
+    appendEntriesArgs->set_leaderid(m_me);
+    appendEntriesArgs->set_leadercommit(m_commitIndex);
+    appendEntriesArgs->set_groupid(m_groupId);
+
+    int inflightEpoch = -1;
+    long long inflightBytes = 0;
+    if (m_inflightCount[server] > 0 && (windowFull || !hasNewEntries))
+    {
+        // 还有请求在途时，心跳不能基于乐观推进后的nextIndex，否则follower还没收到在途的日志就会拒绝，
+        // 引起一次不必要的回退，所以从已经确认匹配的位置发送不带日志的心跳
+        int preLogIndex = std::max(m_matchIndex[server], m_lastSnapshotIncludeIndex);
+        appendEntriesArgs->set_prevlogindex(preLogIndex);
+        appendEntriesArgs->set_prevlogterm(getLogTermFromLogIndex(preLogIndex));
+    }
+    else
+    {
+        int preLogIndex = -1;
+        int preLogTerm = -1;
+        getPrevLogInfo(server, &preLogIndex, &preLogTerm);
+        appendEntriesArgs->set_prevlogindex(preLogIndex);
+        appendEntriesArgs->set_prevlogterm(preLogTerm);
+        // 发给witness的普通日志不带Command，成员变更日志witness也要执行，照常发送
+        bool witness = m_config.IsWitness(server);
+        // 探测时只带一条日志，匹配上之后再按上限分块
+        int maxEntries = probe ? 1 : APPEND_MAX_ENTRIES;
+        for (int index = preLogIndex + 1; index <= lastLogIndex && appendEntriesArgs->entries_size() < maxEntries;
+             ++index)
+        {
+            const auto &entry = m_logs[getSlicesIndexFromLogIndex(index)];
+            bool stripped = witness && entry.type() == raftRpcProto::EntryNormal;
+            long long entryBytes = stripped ? 0 : entry.command().size();
+            if (appendEntriesArgs->entries_size() > 0 && inflightBytes + entryBytes > APPEND_MAX_BYTES)
+                break;
+            raftRpcProto::LogEntry *sendEntryPtr = appendEntriesArgs->add_entries();
+            if (stripped)
             {
-                // 超过就直接添加日志
-                m_logs.push_back(log);
-            } else {
-                if (m_logs[getSlicesIndexFromLogIndex(log.logindex())].logterm() == log.logterm() &&
-                    m_logs[getSlicesIndexFromLogIndex(log.logindex())].command() != log.command())
-                {
-                    // 相同位置的log ，其logTerm相等，但是命令却不相同，不符合raft的前向匹配，异常了！
-                    myAssert(false, format("[func-AppendEntries-rf{%d}] 两节点logIndex{%d}和term{%d}相同，但是其command{%d:%d}   "
-                                           " {%d:%d}却不同！！\n",
-                                           m_me, log.logindex(), log.logterm(), m_me,
-                                           m_logs[getSlicesIndexFromLogIndex(log.logindex())].command(), args->leaderid(),
-                                           log.command()));
-                }
-                if (m_logs[getSlicesIndexFromLogIndex(log.logindex())].logterm() != log.logterm())
-                {
-                    // 不匹配就更新
-                    m_logs[getSlicesIndexFromLogIndex(log.logindex())] = log;
-                }
+                sendEntryPtr->set_logindex(entry.logindex());
+                sendEntryPtr->set_logterm(entry.logterm());
+                continue;
             }
+            *sendEntryPtr = entry;
+            inflightBytes += entryBytes;
         }
-        myAssert(getLastLogIndex() >= args->prevlogindex() + args->entries_size(), format("[func-AppendEntries1-rf{%d}]rf.getLastLogIndex(){%d} != args.PrevLogIndex{%d}+len(args.Entries){%d}", m_me, getLastLogIndex(), args->prevlogindex(), args->entries_size()));
 
-        if (args->leadercommit() > m_commitIndex)
+        if (appendEntriesArgs->entries_size() > 0)
+        {
+            // 不等回复，乐观推进nextIndex，下一批日志可以紧接着发送
+            m_nextIndex[server] = preLogIndex + appendEntriesArgs->entries_size() + 1;
+            if (m_inflightCount[server] == 0)
+                m_inflightProgressTime[server] = now();
+            ++m_inflightCount[server];
+            m_inflightBytes[server] += inflightBytes;
+            inflightEpoch = m_inflightEpoch[server];
+        }
+    }
+
+    auto appendEntriesReply = std::make_shared<raftRpcProto::AppendEntriesReply>();
+    appendEntriesReply->set_appstate(Disconnected);
+    if (m_heartBeatCoalescer != nullptr && appendEntriesArgs->entries_size() == 0 && m_heartBeatCoalescer->Has(server))
+    {
+        // Multi-Raft：纯心跳和其他组发往同一节点的心跳合并成一个rpc
+        int64_t readRound = m_readRoundSeq;
+        ++m_asyncTasks;
+        m_heartBeatCoalescer->Add(server, appendEntriesArgs, appendEntriesReply,
+                                  [this, server, appendEntriesArgs, appendEntriesReply, readRound](bool ok) {
+                                      handleAppendEntriesReply(server, appendEntriesArgs, appendEntriesReply, -1, 0,
+                                                               readRound, ok);
+                                      finishTask();
+                                  });
+        return;
+    }
+    // 前面还有没发出的请求时不再排纯心跳，它们发出时同样会重置follower的选举计时
+    if (inflightEpoch == -1 && !m_appendQueue[server].empty())
+        return;
+    std::shared_ptr<RaftRpcUtil> peer = m_peers[server];
+    int64_t readRound = m_readRoundSeq;
+    m_appendQueue[server].push_back(
+        [this, server, peer, appendEntriesArgs, appendEntriesReply, inflightEpoch, inflightBytes, readRound]()
+        { sendAppendEntries(server, peer, appendEntriesArgs, appendEntriesReply, inflightEpoch, inflightBytes,
+                            readRound); });
+    if (!m_appendSending[server])
+    {
+        m_appendSending[server] = true;
+        spawnTask([this, server]() { appendSendLoop(server); });
+    }
+    // 已经匹配的follower在窗口内继续发送剩下的分块，探测时窗口只有一个请求，这里会直接返回
+    if (inflightEpoch != -1)
+        leaderSendAppendEntries(server, false);
+}
+
+void Raft::appendSendLoop(int server)
+{
+    while (true)
+    {
+        std::function<void()> send;
+        {
+            std::lock_guard<std::mutex> lg(m_mtx);
+            if (m_shutdown)
+                m_appendQueue[server].clear();
+            if (m_appendQueue[server].empty())
+            {
+                m_appendSending[server] = false;
+                return;
+            }
+            send = std::move(m_appendQueue[server].front());
+            m_appendQueue[server].pop_front();
+        }
+        send();
+    }
+}
+
+// 调用前需要持有m_mtx
+void Raft::spawnTask(std::function<void()> task)
+{
+    if (m_shutdown)
+        return;
+    ++m_asyncTasks;
+    runAsync([this, task]()
+             {
+                 task();
+                 finishTask();
+             });
+}
+
+void Raft::finishTask()
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (--m_asyncTasks == 0)
+        m_asyncTasksCond.notify_all();
+}
+
+// inflightEpoch为-1表示该请求不占用在途窗口（心跳）
+// readRound是发送这个请求时的ReadIndex轮次
+bool Raft::sendAppendEntries(int server, std::shared_ptr<RaftRpcUtil> peer,
+                             std::shared_ptr<raftRpcProto::AppendEntriesArgs> args,
+                             std::shared_ptr<raftRpcProto::AppendEntriesReply> reply, int inflightEpoch,
+                             long long inflightBytes, int64_t readRound)
+{
+    bool ok = peer->AppendEntries(args.get(), reply.get());
+    handleAppendEntriesReply(server, args, reply, inflightEpoch, inflightBytes, readRound, ok);
+    return ok;
+}
+
+void Raft::handleAppendEntriesReply(int server, std::shared_ptr<raftRpcProto::AppendEntriesArgs> args,
+                                    std::shared_ptr<raftRpcProto::AppendEntriesReply> reply, int inflightEpoch,
+                                    long long inflightBytes, int64_t readRound, bool ok)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    // 发送之后节点已经被移出配置，它的状态可能已经不存在了
+    if (!m_config.Contains(server))
+        return;
+    bool counted = inflightEpoch != -1 && inflightEpoch == m_inflightEpoch[server];
+    if (counted)
+    {
+        --m_inflightCount[server];
+        m_inflightBytes[server] -= inflightBytes;
+        m_inflightProgressTime[server] = now();
+    }
+
+    if (!ok || reply->appstate() == Disconnected)
+    {
+        // 请求丢失，之后乐观发出的请求都会被拒绝，直接回退到这个请求的起点
+        if (counted && m_status == Leader && args->term() == m_currentTerm)
         {
-            m_commitIndex = std::min(args->leadercommit(), getLastLogIndex());
+            m_nextIndex[server] = std::max(m_matchIndex[server] + 1,
+                                           std::min(m_nextIndex[server], args->prevlogindex() + 1));
+            if (m_progressState[server] == ProgressReplicate)
+                becomeProgress(server, ProgressProbe);
         }
+        return;
+    }
+
+    if (reply->term() > m_currentTerm)
+    {
+        // 对方的term更大，退回follower
+        m_status = Follower;
+        m_currentTerm = reply->term();
+        m_votedFor = -1;
+        m_leaderId = -1;
+        persist();
+        m_readCond.notify_all();
+        m_transferCond.notify_all();
+        refreshProposalGate();
+        return;
     }
-}
\ No newline at end of file
+    if (reply->term() < m_currentTerm || m_status != Leader || args->term() != m_currentTerm)
+    {
+        // 过期的回复
+        return;
+    }
+
+    // 不管日志是否匹配，同一term的回复都说明对方在readRound时承认自己是leader
+    if (readRound > m_peerAckRound[server])
+    {
+        m_peerAckRound[server] = readRound;
+        int64_t confirmed = readRoundConfirmed();
+        m_readRoundStartTime.erase(m_readRoundStartTime.begin(), m_readRoundStartTime.lower_bound(confirmed));
+        m_readCond.notify_all();
+        // 有读请求在等下一轮，而当前轮次已经确认，立即开始下一轮
+        if (m_readRoundWanted > m_readRoundSeq && confirmed == m_readRoundSeq)
+            broadcastHeartBeat();
+    }
+
+    myAssert(reply->term() == m_currentTerm,
+             format("reply.Term{%d} != rf.currentTerm{%d}   ", reply->term(), m_currentTerm));
+    if (!reply->success())
+    {
+        // 发送快照期间nextIndex由快照线程决定
+        if (reply->updatenextindex() != -100 && m_progressState[server] != ProgressSnapshot)
+        {
+            int nextIndex = reply->updatenextindex();
+            if (reply->conflictterm() != -1)
+            {
+                // 自己也有ConflictTerm的日志，两边在这个term内可能是一致的，从自己这个term的最后一条之后开始；
+                // 否则follower的整个ConflictTerm都是冲突的，直接跳到它的第一条
+                int maxIndex = std::min(args->prevlogindex(), getLastLogIndex());
+                int lastIndexOfTerm = maxIndex < m_lastSnapshotIncludeIndex
+                                          ? -1
+                                          : getLastLogIndexOfTerm(reply->conflictterm(), maxIndex);
+                if (lastIndexOfTerm != -1)
+                    nextIndex = lastIndexOfTerm + 1;
+            }
+            // 回退不能早于已经确认匹配的位置；过期请求的拒绝也不能把nextIndex往后推
+            m_nextIndex[server] = std::max(m_matchIndex[server] + 1, std::min(m_nextIndex[server], nextIndex));
+            // 之后乐观发出的请求也都会被拒绝，回到探测状态重新寻找匹配的位置
+            if (m_progressState[server] == ProgressReplicate && args->prevlogindex() >= m_matchIndex[server])
+                becomeProgress(server, ProgressProbe);
+        }
+    }
+    else
+    {
+        // 回复可能乱序到达，matchIndex和nextIndex都只前进不后退
+        int oldMatchIndex = m_matchIndex[server];
+        m_matchIndex[server] = std::max(m_matchIndex[server], args->prevlogindex() + args->entries_size());
+        m_nextIndex[server] = std::max(m_nextIndex[server], m_matchIndex[server] + 1);
+        if (m_progressState[server] == ProgressProbe)
+            becomeProgress(server, ProgressReplicate);
+        if (server == m_leadTransferee)
+            m_transferCond.notify_all();
+        myAssert(m_nextIndex[server] <= getLastLogIndex() + 1,
+                 format("error msg:rf.nextIndex[%d] > lastLogIndex+1, len(rf.logs) = %d   lastLogIndex{%d} = %d",
+                        server, m_logs.size(), server, getLastLogIndex()));
+        // 心跳和乱序的旧回复不推进matchIndex，不需要重新计算提交位置
+        if (m_matchIndex[server] > oldMatchIndex && m_config.IsVoter(server))
+            leaderUpdateCommitIndex();
+    }
+    // 窗口有空位或者刚刚回退，有日志就立即继续发送，不必等下一次心跳
+    leaderSendAppendEntries(server, false);
+}
+
+void Raft::resetInflight(int server)
+{
+    // 所有节点共用一个递增序号，节点被移除再以同一个id加入后，之前的回复也不会被当成当前窗口的
+    m_inflightEpoch[server] = ++m_inflightEpochSeq;
+    m_inflightCount[server] = 0;
+    m_inflightBytes[server] = 0;
+    m_inflightProgressTime[server] = now();
+}
+
+// 调用前需要持有m_mtx
+// 进入探测或快照状态时，之前乐观发出的请求不再占用窗口
+void Raft::becomeProgress(int server, ProgressState state)
+{
+    if (m_progressState[server] == state)
+        return;
+    DPrintf("[func-becomeProgress-rf{%d}] follower{%d}的复制状态{%d}->{%d}，nextIndex{%d} matchIndex{%d}", m_me, server,
+            m_progressState[server], state, m_nextIndex[server], m_matchIndex[server]);
+    m_progressState[server] = state;
+    if (state != ProgressReplicate)
+        resetInflight(server);
+}
+
+// 调用前需要持有m_mtx
+// 只在某个voter的matchIndex（或leader自己落盘的位置）推进、以及voter集合变化时调用
+void Raft::leaderUpdateCommitIndex()
+{
+    // 多数voter都已经复制到的位置，用nth_element一次求出，不再逐个logIndex统计
+    // 只有voter计入多数派，leader自己的日志要等本地落盘之后才能计入
+    int quorumIndex = m_config.QuorumValue([&](int id) -> int64_t {
+        return id == m_me ? m_persistedLogIndex : m_matchIndex[id];
+    });
+    quorumIndex = std::min(quorumIndex, getLastLogIndex());
+    if (quorumIndex <= m_commitIndex)
+        return;
+    // 只能直接提交当前term的日志，之前term的日志随之间接提交
+    // term随logIndex单调不减，quorumIndex不是当前term时更小的位置也都不是
+    if (getLogTermFromLogIndex(quorumIndex) != m_currentTerm)
+        return;
+    advanceCommitIndex(quorumIndex);
+}
+
+// 调用前需要持有m_mtx
+// 成员变更日志在提交时生效，m_config.Index()之前的变更已经通过快照生效过，跳过
+void Raft::advanceCommitIndex(int commitIndex)
+{
+    bool configChanged = false;
+    for (int index = std::max(m_commitIndex, m_config.Index()) + 1; index <= commitIndex; index++)
+    {
+        const auto &entry = m_logs[getSlicesIndexFromLogIndex(index)];
+        if (entry.type() == raftRpcProto::EntryConfChange)
+        {
+            applyConfChange(entry);
+            configChanged = true;
+        }
+    }
+    m_commitIndex = commitIndex;
+    // 直接唤醒applier，不用等它下一次轮询
+    m_applyCond.notify_one();
+    if (!configChanged || m_status != Leader)
+        return;
+
+    if (!m_config.IsVoter(m_me))
+    {
+        // 自己已经被移出集群：先把新的commitIndex告诉follower，再退位，由新配置中的节点选出leader
+        DPrintf("[func-advanceCommitIndex-rf{%d}] 已经不在新配置中，退位", m_me);
+        broadcastHeartBeat();
+        m_status = Follower;
+        m_leaderId = -1;
+        m_lastResetElectionTime = now();
+        m_readCond.notify_all();
+        m_transferCond.notify_all();
+        refreshProposalGate();
+        return;
+    }
+    // 过渡配置提交之后立即离开
+    if (m_config.Joint() && m_pendingConfIndex <= m_commitIndex)
+    {
+        raftRpcProto::ConfChange cc;
+        cc.set_type(raftRpcProto::ConfLeaveJoint);
+        proposeConfChange(cc);
+    }
+    // voter集合变了，多数派可能已经复制到更后面
+    leaderUpdateCommitIndex();
+}
+
+// 调用前需要持有m_mtx
+void Raft::applyConfChange(const raftRpcProto::LogEntry &entry)
+{
+    raftRpcProto::ConfChange cc;
+    RaftConfig oldConfig = m_config;
+    if (!cc.ParseFromString(entry.command()) || !m_config.Apply(cc, entry.logindex()))
+    {
+        DPrintf("[func-applyConfChange-rf{%d}] logIndex{%d}的成员变更不合法，忽略", m_me, entry.logindex());
+        return;
+    }
+    DPrintf("[func-applyConfChange-rf{%d}] logIndex{%d}的成员变更生效：type{%d}，voter{%d}个，旧voter{%d}个，learner{%d}个",
+            m_me, entry.logindex(), cc.type(), m_config.Voters().size(), m_config.OutgoingVoters().size(),
+            m_config.Learners().size());
+    syncPeers(oldConfig);
+}
+
+// 调用前需要持有m_mtx
+// 配置变化后建立到新节点的连接、关闭到被移除节点的连接，每个节点一份的状态跟着节点id增长和收缩
+void Raft::syncPeers(const RaftConfig &oldConfig)
+{
+    std::set<int> members = m_config.Members();
+    int size = m_me + 1;
+    if (!members.empty())
+        size = std::max(size, *members.rbegin() + 1);
+    if (size > static_cast<int>(m_peers.size()))
+        resizePeers(size);
+
+    for (int id : members)
+    {
+        if (id == m_me)
+            continue;
+        if (m_peers[id] == nullptr)
+        {
+            auto it = m_config.Addrs().find(id);
+            if (it != m_config.Addrs().end())
+            {
+                // 在锁内创建，连接推迟到第一次发送
+                m_peers[id] = std::make_shared<RaftRpcUtil>(it->second.ip(), it->second.port(),
+                                                            RPC_CONNECTIONS_PER_PEER, true);
+            }
+            else
+            {
+                DPrintf("[func-syncPeers-rf{%d}] 不知道节点{%d}的地址", m_me, id);
+            }
+        }
+        if (m_status == Leader && !oldConfig.Contains(id))
+        {
+            // 新加入的节点从最后一条日志开始探测，被拒绝后回退，需要的日志已经被快照时改发快照
+            m_nextIndex[id] = getLastLogIndex() + 1;
+            m_matchIndex[id] = 0;
+            resetInflight(id);
+            m_progressState[id] = ProgressProbe;
+            m_peerAckRound[id] = 0;
+            leaderSendAppendEntries(id, true);
+        }
+    }
+
+    // 被移除的节点：在途的请求持有自己的shared_ptr，最后一个请求结束后连接关闭
+    for (int id : oldConfig.Members())
+    {
+        if (id != m_me && !m_config.Contains(id) && id < static_cast<int>(m_peers.size()))
+            m_peers[id] = nullptr;
+    }
+    // 末尾没有连接的节点不再保留状态
+    int last = m_peers.size();
+    while (last > size && m_peers[last - 1] == nullptr)
+        last--;
+    if (last < static_cast<int>(m_peers.size()))
+        resizePeers(last);
+}
+
+// 调用前需要持有m_mtx
+void Raft::resizePeers(int size)
+{
+    int oldSize = m_peers.size();
+    m_peers.resize(size);
+    m_nextIndex.resize(size, getLastLogIndex() + 1);
+    m_matchIndex.resize(size, 0);
+    m_inflightCount.resize(size, 0);
+    m_inflightBytes.resize(size, 0);
+    m_inflightEpoch.resize(size, 0);
+    m_inflightProgressTime.resize(size, now());
+    m_peerAckRound.resize(size, 0);
+    m_snapshotSending.resize(size, false);
+    m_appendQueue.resize(size);
+    m_appendSending.resize(size, false);
+    m_progressState.resize(size, ProgressProbe);
+    for (int id = oldSize; id < size; id++)
+        resetInflight(id);
+}
+
+void Raft::getPrevLogInfo(int server, int *preIndex, int *preTerm)
+{
+    // nextIndex紧接着快照，prevLog就是快照的最后一条
+    if (m_nextIndex[server] == m_lastSnapshotIncludeIndex + 1)
+    {
+        *preIndex = m_lastSnapshotIncludeIndex;
+        *preTerm = m_lastSnapshotIncludeTerm;
+        return;
+    }
+    auto nextIndex = m_nextIndex[server];
+    *preIndex = nextIndex - 1;
+    *preTerm = m_logs[getSlicesIndexFromLogIndex(*preIndex)].logterm();
+}
+
+bool Raft::matchLog(int logIndex, int logTerm)
+{
+    myAssert(logIndex >= m_lastSnapshotIncludeIndex && logIndex <= getLastLogIndex(),
+             format("不满足：logIndex{%d}>=rf.lastSnapshotIncludeIndex{%d}&&logIndex{%d}<=rf.getLastLogIndex{%d}",
+                    logIndex, m_lastSnapshotIncludeIndex, logIndex, getLastLogIndex()));
+    return logTerm == getLogTermFromLogIndex(logIndex);
+}
+
+int Raft::getLastLogIndex()
+{
+    int lastLogIndex = -1;
+    int _ = -1;
+    getLastLogIndexAndTerm(&lastLogIndex, &_);
+    return lastLogIndex;
+}
+
+int Raft::getLastLogTerm()
+{
+    int _ = -1;
+    int lastLogTerm = -1;
+    getLastLogIndexAndTerm(&_, &lastLogTerm);
+    return lastLogTerm;
+}
+
+void Raft::getLastLogIndexAndTerm(int *lastLogIndex, int *lastLogTerm)
+{
+    if (m_logs.empty())
+    {
+        *lastLogIndex = m_lastSnapshotIncludeIndex;
+        *lastLogTerm = m_lastSnapshotIncludeTerm;
+        return;
+    }
+    *lastLogIndex = m_logs[m_logs.size() - 1].logindex();
+    *lastLogTerm = m_logs[m_logs.size() - 1].logterm();
+}
+
+int Raft::getLogTermFromLogIndex(int logIndex)
+{
+    myAssert(logIndex >= m_lastSnapshotIncludeIndex,
+             format("[func-getSlicesIndexFromLogIndex-rf{%d}]  index{%d} < rf.lastSnapshotIncludeIndex{%d}", m_me,
+                    logIndex, m_lastSnapshotIncludeIndex));
+    int lastLogIndex = getLastLogIndex();
+    myAssert(logIndex <= lastLogIndex, format("[func-getSlicesIndexFromLogIndex-rf{%d}]  logIndex{%d} > lastLogIndex{%d}",
+                                              m_me, logIndex, lastLogIndex));
+    if (logIndex == m_lastSnapshotIncludeIndex)
+        return m_lastSnapshotIncludeTerm;
+    return m_logs[getSlicesIndexFromLogIndex(logIndex)].logterm();
+}
+
+int Raft::getFirstLogIndexOfTerm(int term, int maxIndex)
+{
+    int lo = m_lastSnapshotIncludeIndex + 1;
+    int hi = maxIndex;
+    while (lo < hi)
+    {
+        int mid = lo + (hi - lo) / 2;
+        if (getLogTermFromLogIndex(mid) < term)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+int Raft::getLastLogIndexOfTerm(int term, int maxIndex)
+{
+    int lo = m_lastSnapshotIncludeIndex;
+    int hi = maxIndex;
+    if (getLogTermFromLogIndex(lo) > term)
+        return -1;
+    while (lo < hi)
+    {
+        int mid = hi - (hi - lo) / 2;
+        if (getLogTermFromLogIndex(mid) <= term)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return getLogTermFromLogIndex(lo) == term ? lo : -1;
+}
+
+// 找到index对应的真实下标位置
+// 限制，输入的logIndex必须保存在当前的logs里面（不包含snapshot）
+int Raft::getSlicesIndexFromLogIndex(int logIndex)
+{
+    myAssert(logIndex > m_lastSnapshotIncludeIndex,
+             format("[func-getSlicesIndexFromLogIndex-rf{%d}]  index{%d} <= rf.lastSnapshotIncludeIndex{%d}", m_me,
+                    logIndex, m_lastSnapshotIncludeIndex));
+    int lastLogIndex = getLastLogIndex();
+    myAssert(logIndex <= lastLogIndex, format("[func-getSlicesIndexFromLogIndex-rf{%d}]  logIndex{%d} > lastLogIndex{%d}",
+                                              m_me, logIndex, lastLogIndex));
+    return logIndex - m_lastSnapshotIncludeIndex - 1;
+}
+
+void Raft::GetState(int *term, bool *isLeader)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    *term = m_currentTerm;
+    *isLeader = (m_status == Leader);
+}
+
+void Raft::Start(OperaionFromRaft command, int *newLogIndex, int *newLogTerm, bool *isLeader)
+{
+    std::unique_lock<std::mutex> lock(m_proposalMtx);
+    // 领导权转移期间不再接受新日志，否则目标节点永远追不上；客户端会去找新的leader重试
+    if (!m_proposalOpen)
+    {
+        DPrintf("[func-Start-rf{%d}]  is not leader", m_me);
+        *newLogIndex = -1;
+        *newLogTerm = -1;
+        *isLeader = false;
+        return;
+    }
+
+    raftRpcProto::LogEntry newLogEntry;
+    newLogEntry.set_command(command.asString());
+    newLogEntry.set_logterm(m_proposalTerm);
+    newLogEntry.set_logindex(m_proposalNextIndex++);
+    *newLogIndex = newLogEntry.logindex();
+    *newLogTerm = newLogEntry.logterm();
+    *isLeader = true;
+    m_proposalQueueBytes += newLogEntry.command().size();
+    m_proposalQueue.emplace_back(std::move(newLogEntry));
+
+    // 空闲时直接发出，不增加延迟；并发提案多时攒成一批，共用一次WAL追加和一个AppendEntries
+    auto nowTime = now();
+    bool flushNow = m_proposalQueue.size() >= PROPOSAL_BATCH_MAX_COUNT ||
+                    m_proposalQueueBytes >= PROPOSAL_BATCH_MAX_BYTES;
+    if (m_proposalQueue.size() == 1)
+    {
+        if (nowTime - m_lastProposalFlushTime >= std::chrono::microseconds(PROPOSAL_BATCH_WINDOW_US))
+        {
+            flushNow = true;
+        }
+        else
+        {
+            m_firstPendingProposalTime = nowTime;
+            m_proposalCond.notify_one();
+        }
+    }
+    if (!flushNow)
+        return;
+    // 按锁顺序先放开m_proposalMtx；期间别的线程可能已经把这一批发出，flushProposals会发现队列为空
+    lock.unlock();
+    std::lock_guard<std::mutex> lg(m_mtx);
+    flushProposals();
+}
+
+// 在攒批窗口结束时发出还在等待的提案
+void Raft::proposalBatcher()
+{
+    std::unique_lock<std::mutex> lock(m_proposalMtx);
+    while (true)
+    {
+        waitCond(m_proposalCond, lock, [&]() { return !m_proposalQueue.empty(); });
+        auto deadline = m_firstPendingProposalTime + std::chrono::microseconds(PROPOSAL_BATCH_WINDOW_US);
+        waitUntil(m_proposalCond, lock, deadline, [&]() { return m_proposalQueue.empty(); });
+        if (m_proposalQueue.empty())
+            continue;
+        lock.unlock();
+        {
+            std::lock_guard<std::mutex> lg(m_mtx);
+            flushProposals();
+        }
+        lock.lock();
+    }
+}
+
+// 调用前需要持有m_mtx
+// 本地落盘和向follower复制同时进行：AppendLog只写到page cache，
+// 由Persister的落盘线程组提交fsync，完成后再把leader自己计入多数派
+void Raft::flushProposals()
+{
+    appendProposals();
+    // 攒批期间已经退位时提案已经被丢弃，交给客户端超时重试；这一批已经被别的线程发出时没有新日志
+    if (m_status != Leader || m_logDirtyFrom == INT_MAX)
+        return;
+
+    int logIndex = -1;
+    int logTerm = -1;
+    getLastLogIndexAndTerm(&logIndex, &logTerm);
+    uint64_t ticket = persistLog();
+    // 回调在落盘线程中捕获this执行，计入m_asyncTasks，Shutdown要等它结束
+    ++m_asyncTasks;
+    m_persister->OnDurable(ticket,
+                           [this, logIndex, logTerm]()
+                           {
+                               onLogPersisted(logIndex, logTerm);
+                               finishTask();
+                           });
+
+    for (int i = 0; i < static_cast<int>(m_peers.size()); i++)
+    {
+        if (i == m_me || !m_config.Contains(i))
+            continue;
+        leaderSendAppendEntries(i, false);
+    }
+}
+
+// 调用前需要持有m_mtx
+// 把m_proposalQueue中的提案追加到m_logs
+void Raft::appendProposals()
+{
+    std::lock_guard<std::mutex> lg(m_proposalMtx);
+    drainProposalQueue();
+}
+
+// 调用前需要持有m_mtx和m_proposalMtx
+void Raft::drainProposalQueue()
+{
+    m_lastProposalFlushTime = now();
+    m_proposalCond.notify_all();
+    if (m_proposalQueue.empty())
+        return;
+    myAssert(m_status == Leader && m_proposalTerm == m_currentTerm &&
+                 m_proposalQueue.front().logindex() == getLastLogIndex() + 1,
+             format("[func-appendProposals-rf{%d}] 提案的logIndex{%d}、term{%d}和日志末尾{%d}、term{%d}接不上", m_me,
+                    m_proposalQueue.front().logindex(), m_proposalTerm, getLastLogIndex(), m_currentTerm));
+    markLogDirty(m_proposalQueue.front().logindex());
+    for (auto &entry : m_proposalQueue)
+        m_logs.emplace_back(std::move(entry));
+    m_proposalQueue.clear();
+    m_proposalQueueBytes = 0;
+}
+
+// 调用前需要持有m_mtx
+// leader自己产生的日志（成员变更）和Start()的提案共用m_proposalNextIndex分配logIndex：
+// 在同一个m_proposalMtx临界区内先追加已经分配了logIndex的提案，再追加这一条并推进m_proposalNextIndex，
+// Start()不会再拿到同一个logIndex
+void Raft::appendLeaderEntry(raftRpcProto::LogEntry *entry)
+{
+    std::lock_guard<std::mutex> lg(m_proposalMtx);
+    drainProposalQueue();
+    m_proposalNextIndex = getLastLogIndex() + 1;
+    entry->set_logterm(m_currentTerm);
+    entry->set_logindex(m_proposalNextIndex++);
+    m_logs.emplace_back(*entry);
+    markLogDirty(entry->logindex());
+}
+
+// 调用前需要持有m_mtx
+// 身份、term或者m_leadTransferee变化之后调用，把是否接受提案同步给Start()
+void Raft::refreshProposalGate()
+{
+    std::lock_guard<std::mutex> lg(m_proposalMtx);
+    if (m_status != Leader || m_proposalTerm != m_currentTerm)
+    {
+        // 退位或者换了任期，还没追加的提案作废，已经返回给客户端的logIndex不会被提交，客户端超时后重试
+        m_proposalQueue.clear();
+        m_proposalQueueBytes = 0;
+        m_proposalCond.notify_all();
+    }
+    m_proposalTerm = m_currentTerm;
+    m_proposalOpen = m_status == Leader && m_leadTransferee == -1;
+    if (m_proposalQueue.empty())
+        m_proposalNextIndex = getLastLogIndex() + 1;
+}
+
+// 在Persister的落盘线程中回调
+void Raft::onLogPersisted(int logIndex, int logTerm)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    // 落盘期间这条日志可能已经被新leader覆盖，term对不上就不算
+    if (logIndex > m_lastSnapshotIncludeIndex &&
+        (logIndex > getLastLogIndex() || getLogTermFromLogIndex(logIndex) != logTerm))
+        return;
+
+    if (logIndex <= m_persistedLogIndex)
+        return;
+    m_persistedLogIndex = logIndex;
+    if (m_status == Leader)
+        leaderUpdateCommitIndex();
+}
+
+void Raft::Snapshot(int index, std::string snapshot)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+
+    if (m_lastSnapshotIncludeIndex >= index || index > m_commitIndex)
+    {
+        DPrintf("[func-Snapshot-rf{%d}] rejects replacing log with snapshotIndex %d as current snapshotIndex %d is larger or "
+                "smaller ",
+                m_me, index, m_lastSnapshotIncludeIndex);
+        return;
+    }
+    compactLog(index, std::move(snapshot));
+}
+
+// 调用前需要持有m_mtx
+// 丢弃index及之前的日志，witness的snapshot为空
+void Raft::compactLog(int index, std::string snapshot)
+{
+    auto lastLogIndex = getLastLogIndex();
+
+    int newLastSnapshotIncludeIndex = index;
+    int newLastSnapshotIncludeTerm = m_logs[getSlicesIndexFromLogIndex(index)].logterm();
+    // 只移动日志容器的起点并释放整块，剩下的日志不需要拷贝
+    m_logs.truncatePrefix(getSlicesIndexFromLogIndex(index) + 1);
+    m_lastSnapshotIncludeIndex = newLastSnapshotIncludeIndex;
+    m_lastSnapshotIncludeTerm = newLastSnapshotIncludeTerm;
+    m_commitIndex = std::max(m_commitIndex, index);
+    m_lastApplied = std::max(m_lastApplied, index);
+
+    m_persister->Save(persistData(), snapshot);
+    m_persistedHardState = hardState();
+    // WAL中被快照完全覆盖的段直接删除
+    m_persister->CompactLog(index);
+
+    DPrintf("[SnapShot]Server %d snapshot snapshot index {%d}, term {%d}, loglen {%d}", m_me, index,
+            m_lastSnapshotIncludeTerm, m_logs.size());
+    myAssert(static_cast<int>(m_logs.size()) + m_lastSnapshotIncludeIndex == lastLogIndex,
+             format("len(rf.logs){%d} + rf.lastSnapshotIncludeIndex{%d} != lastLogjInde{%d}", m_logs.size(),
+                    m_lastSnapshotIncludeIndex, lastLogIndex));
+}
+
+// 快照分块发送：每次只读一块，leader和follower都不需要把整个快照放进内存
+// 连接断开后下次从follower已经收到的位置继续
+void Raft::leaderSendSnapShot(int server)
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    if (!m_config.Contains(server) || m_snapshotSending[server] || m_progressState[server] != ProgressSnapshot)
+        return;
+    m_snapshotSending[server] = true;
+    std::shared_ptr<RaftRpcUtil> peer = m_peers[server];
+
+    int term = m_currentTerm;
+    int snapshotIndex = m_lastSnapshotIncludeIndex;
+    int snapshotTerm = m_lastSnapshotIncludeTerm;
+    raftRpcProto::ClusterConfig config;
+    m_config.ToProto(&config);
+    // witness只需要快照的index和term，直接发送一个空的最后一块
+    bool witness = m_config.IsWitness(server);
+    long long total = witness ? 0 : m_persister->SnapshotSize();
+    // 第一次发送空的一块，问出follower已经收到了多少
+    long long offset = 0;
+    bool probe = !witness;
+    while (m_status == Leader && m_currentTerm == term && m_lastSnapshotIncludeIndex == snapshotIndex)
+    {
+        std::string chunk;
+        if (!probe && !witness)
+        {
+            lock.unlock();
+            chunk = m_persister->ReadSnapshotChunk(offset, SNAPSHOT_CHUNK_BYTES);
+            lock.lock();
+            // 读的过程中产生了新快照，读到的可能已经是新快照的内容
+            if (m_lastSnapshotIncludeIndex != snapshotIndex)
+                break;
+        }
+        raftRpcProto::InstallSnapshotRequest args;
+        raftRpcProto::InstallSnapshotResponse reply;
+        args.set_leaderid(m_me);
+        args.set_term(term);
+        args.set_lastsnapshotincludeindex(snapshotIndex);
+        args.set_lastsnapshotincludeterm(snapshotTerm);
+        args.set_offset(offset);
+        args.set_done(!probe && offset + static_cast<long long>(chunk.size()) >= total);
+        args.set_groupid(m_groupId);
+        *args.mutable_config() = config;
+        args.set_data(std::move(chunk));
+        probe = false;
+
+        lock.unlock();
+        bool ok = peer->InstallSnapshot(&args, &reply);
+        lock.lock();
+        // 发送期间节点被移出配置，它的状态可能已经不存在了
+        if (!m_config.Contains(server))
+            return;
+        if (!ok)
+        {
+            // 之后的心跳会重新发起，follower记得已经收到的部分
+            break;
+        }
+        if (reply.term() > m_currentTerm)
+        {
+            m_status = Follower;
+            m_currentTerm = reply.term();
+            m_votedFor = -1;
+            m_leaderId = -1;
+            persist();
+            m_readCond.notify_all();
+            m_transferCond.notify_all();
+            refreshProposalGate();
+            break;
+        }
+        if (m_status != Leader || m_currentTerm != term)
+            break;
+        if (reply.installed())
+        {
+            m_matchIndex[server] = std::max(m_matchIndex[server], snapshotIndex);
+            m_nextIndex[server] = std::max(m_nextIndex[server], snapshotIndex + 1);
+            m_snapshotSending[server] = false;
+            becomeProgress(server, ProgressProbe);
+            leaderSendAppendEntries(server, false);
+            return;
+        }
+        offset = reply.offset();
+    }
+    m_snapshotSending[server] = false;
+    // 没有发完，之后的心跳重新探测，仍然需要快照时再发起；期间已经换了任期时状态已经被重置
+    if (m_progressState[server] == ProgressSnapshot)
+        becomeProgress(server, ProgressProbe);
+}
+
+void Raft::InstallSnapshot(const raftRpcProto::InstallSnapshotRequest *args,
+                           raftRpcProto::InstallSnapshotResponse *reply)
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    reply->set_installed(false);
+    reply->set_offset(0);
+    if (args->term() < m_currentTerm)
+    {
+        reply->set_term(m_currentTerm);
+        return;
+    }
+    if (args->term() > m_currentTerm)
+    {
+        m_currentTerm = args->term();
+        m_votedFor = -1;
+        persist();
+        // 旧leader退位，唤醒等待ReadIndex确认和领导权转移的线程
+        m_readCond.notify_all();
+        m_transferCond.notify_all();
+    }
+    m_status = Follower;
+    refreshProposalGate();
+    m_leaderId = args->leaderid();
+    m_lastResetElectionTime = now();
+    reply->set_term(m_currentTerm);
+
+    // 已经有更新的快照
+    if (args->lastsnapshotincludeindex() <= m_lastSnapshotIncludeIndex)
+    {
+        reply->set_installed(true);
+        return;
+    }
+
+    bool witness = m_config.IsWitness(m_me);
+    if (witness && !args->done())
+    {
+        // witness不保存快照内容，跳过数据块
+        reply->set_offset(args->offset() + args->data().size());
+        return;
+    }
+
+    if (!witness)
+    {
+        if (args->lastsnapshotincludeindex() != m_snapshotRecvIndex ||
+            args->lastsnapshotincludeterm() != m_snapshotRecvTerm)
+        {
+            // 新的快照只能从头开始接收，之前没收完的作废
+            if (args->offset() != 0)
+                return;
+            m_snapshotRecvIndex = args->lastsnapshotincludeindex();
+            m_snapshotRecvTerm = args->lastsnapshotincludeterm();
+            m_snapshotRecvOffset = 0;
+            m_persister->BeginReceivedSnapshot();
+        }
+        // 不是接着已经收到的部分，告诉leader从哪里继续
+        if (args->offset() != m_snapshotRecvOffset)
+        {
+            reply->set_offset(m_snapshotRecvOffset);
+            return;
+        }
+        if (!args->data().empty())
+        {
+            m_persister->AppendReceivedSnapshot(args->data());
+            m_snapshotRecvOffset += args->data().size();
+        }
+        reply->set_offset(m_snapshotRecvOffset);
+        if (!args->done())
+            return;
+    }
+
+    // 快照之前的成员变更日志已经没有了，直接采用leader已经提交的配置，
+    // 之后再提交到Index之前的变更日志时跳过
+    RaftConfig config = RaftConfig::FromProto(args->config());
+    if (config.Index() > m_config.Index())
+    {
+        RaftConfig oldConfig = m_config;
+        m_config = config;
+        syncPeers(oldConfig);
+    }
+    // 全部收到，在锁内读出，避免另一个快照的第一块把临时文件清空
+    std::string snapshot = witness ? "" : m_persister->ReadReceivedSnapshot();
+    m_snapshotRecvIndex = -1;
+    m_snapshotRecvTerm = -1;
+    m_snapshotRecvOffset = 0;
+    lock.unlock();
+    // 返回false说明快照已经被本地的快照或日志覆盖，对leader来说同样不需要再发送
+    CondInstallSnapshot(args->lastsnapshotincludeterm(), args->lastsnapshotincludeindex(), snapshot);
+    reply->set_installed(true);
+}
+
+void Raft::InstallSnapshot(google::protobuf::RpcController * /*controller*/,
+                           const ::raftRpcProto::InstallSnapshotRequest *request,
+                           ::raftRpcProto::InstallSnapshotResponse *response, ::google::protobuf::Closure *done)
+{
+    InstallSnapshot(request, response);
+    done->Run();
+}
+
+// 用收到的快照替换日志，并把快照交给上层状态机
+bool Raft::CondInstallSnapshot(int lastIncludedTerm, int lastIncludedIndex, std::string snapshot)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (lastIncludedIndex <= m_lastSnapshotIncludeIndex)
+        return false;
+
+    int lastLogIndex = getLastLogIndex();
+    bool keepSuffix = lastIncludedIndex <= lastLogIndex && getLogTermFromLogIndex(lastIncludedIndex) == lastIncludedTerm;
+    if (keepSuffix)
+    {
+        // 快照之后的日志和leader一致，保留
+        m_logs.truncatePrefix(getSlicesIndexFromLogIndex(lastIncludedIndex) + 1);
+    }
+    else
+    {
+        m_logs.clear();
+        // 被丢弃的日志也要从WAL中删掉
+        m_persister->TruncateLog(lastIncludedIndex + 1);
+        m_walLastIndex = -1;
+        m_logDirtyFrom = INT_MAX;
+    }
+    m_lastSnapshotIncludeIndex = lastIncludedIndex;
+    m_lastSnapshotIncludeTerm = lastIncludedTerm;
+    m_commitIndex = std::max(m_commitIndex, lastIncludedIndex);
+    // 丢弃了快照之后的日志时，原来落盘到的位置不再有效
+    m_persistedLogIndex = keepSuffix ? std::max(m_persistedLogIndex, lastIncludedIndex) : lastIncludedIndex;
+
+    m_persister->Save(persistData(), snapshot);
+    m_persistedHardState = hardState();
+    m_persister->CompactLog(lastIncludedIndex);
+
+    // witness没有状态机
+    if (m_config.IsWitness(m_me))
+        m_lastApplied = std::max(m_lastApplied, lastIncludedIndex);
+    // 状态机已经执行到快照之后就不需要再安装
+    if (m_lastApplied < lastIncludedIndex)
+    {
+        m_lastApplied = lastIncludedIndex;
+        // 交给applier发出，排在已经取走的日志之后、之后的日志之前；还没发出的旧快照被新的代替
+        m_pendingSnapshotMsg = std::make_shared<ApplyMsg>();
+        m_pendingSnapshotMsg->CommandValid = false;
+        m_pendingSnapshotMsg->SnapshotValid = true;
+        m_pendingSnapshotMsg->Snapshot = std::move(snapshot);
+        m_pendingSnapshotMsg->SnapshotTerm = lastIncludedTerm;
+        m_pendingSnapshotMsg->SnapshotIndex = lastIncludedIndex;
+        m_applyCond.notify_one();
+        m_readCond.notify_all();
+    }
+    return true;
+}
+
+void Raft::AppendEntries(const raftRpcProto::AppendEntriesArgs *args, raftRpcProto::AppendEntriesReply *reply)
+{
+    WaitDurable(AppendEntriesDeferSync(args, reply));
+}
+
+uint64_t Raft::AppendEntriesDeferSync(const raftRpcProto::AppendEntriesArgs *args,
+                                      raftRpcProto::AppendEntriesReply *reply)
+{
+    AppendEntriesAnotherVersion(args, reply);
+    // 日志写入WAL之后还要等落盘才能回复leader，等待时不持有m_mtx，多个请求共享一次fsync
+    // 被拒绝的请求没有写入日志，返回0，不需要等待
+    return reply->success() ? m_persister->LastAppendTicket() : 0;
+}
+
+void Raft::WaitDurable(uint64_t ticket)
+{
+    m_persister->WaitDurable(ticket);
+}
+
+void Raft::AppendEntries(google::protobuf::RpcController * /*controller*/, const ::raftRpcProto::AppendEntriesArgs *request,
+                         ::raftRpcProto::AppendEntriesReply *response, ::google::protobuf::Closure *done)
+{
+    AppendEntries(request, response);
+    done->Run();
+}
+
+int Raft::GetRaftStateSize()
+{
+    return m_persister->RaftStateSize() + m_persister->LogSize();
+}
+
+bool Raft::ReadIndex(int *readIndex)
+{
+    auto deadline = now() + std::chrono::milliseconds(CONSENSUS_TIMEOUT);
+    std::unique_lock<std::mutex> lock(m_mtx);
+    // witness没有数据可读
+    if (m_config.IsWitness(m_me))
+        return false;
+    int index = -1;
+    if (m_status == Leader)
+    {
+        if (!leaderReadIndex(&lock, deadline, &index))
+            return false;
+    }
+    else
+    {
+        // follower读：向leader要一个readIndex，之后在本地读，读请求不再都压到leader上
+        int leaderId = m_leaderId;
+        if (leaderId == -1 || leaderId == m_me || leaderId >= static_cast<int>(m_peers.size()) || m_peers[leaderId] == nullptr)
+            return false;
+        std::shared_ptr<RaftRpcUtil> leader = m_peers[leaderId];
+        raftRpcProto::ReadIndexArgs args;
+        raftRpcProto::ReadIndexReply reply;
+        args.set_term(m_currentTerm);
+        args.set_followerid(m_me);
+        args.set_groupid(m_groupId);
+        lock.unlock();
+        bool ok = leader->ReadIndex(&args, &reply);
+        lock.lock();
+        if (!ok || !reply.success())
+            return false;
+        index = reply.readindex();
+    }
+
+    // 本节点的日志执行到readIndex之后，读到的状态就包含了发起读之前所有已提交的写
+    while (m_lastApplied < index)
+    {
+        if (now() >= deadline)
+            return false;
+        waitFor(m_readCond, lock, std::chrono::milliseconds(ApplyInterval));
+    }
+    *readIndex = index;
+    return true;
+}
+
+// 调用前需要持有m_mtx
+// 记下commitIndex并确认自己仍然是leader，确认之后它就是一个可以安全读取的位置
+bool Raft::leaderReadIndex(std::unique_lock<std::mutex> *lock, std::chrono::_V2::system_clock::time_point deadline,
+                           int *readIndex)
+{
+    if (m_status != Leader)
+        return false;
+    // 新leader在本任期提交第一条日志之前，commitIndex可能落后于真正已提交的位置
+    if (getLogTermFromLogIndex(m_commitIndex) != m_currentTerm)
+        return false;
+
+    int index = m_commitIndex;
+    int term = m_currentTerm;
+    if (LEASE_READ_ENABLED && leaseValid())
+    {
+        // 租约内其他节点不会选出新leader，不需要再确认一轮
+        ++m_leaseReadCount;
+    }
+    else
+    {
+        if (LEASE_READ_ENABLED)
+            ++m_leaseFallbackCount;
+
+        // 需要记下commitIndex之后才发出的一轮心跳来确认
+        int64_t round = m_readRoundSeq + 1;
+        m_readRoundWanted = std::max(m_readRoundWanted, round);
+        // 没有在途的轮次就立即广播；否则当前轮次确认后再统一发下一轮，期间到来的读都共享它
+        if (readRoundConfirmed() == m_readRoundSeq)
+            broadcastHeartBeat();
+
+        while (readRoundConfirmed() < round)
+        {
+            if (m_status != Leader || m_currentTerm != term || now() >= deadline)
+                return false;
+            waitFor(m_readCond, *lock, std::chrono::milliseconds(HeartBeatTimeout));
+        }
+    }
+    *readIndex = index;
+    return true;
+}
+
+// follower读：leader确认自己的身份后返回readIndex，follower自己等待执行到这个位置
+void Raft::ReadIndex(const raftRpcProto::ReadIndexArgs *args, raftRpcProto::ReadIndexReply *reply)
+{
+    auto deadline = now() + std::chrono::milliseconds(CONSENSUS_TIMEOUT);
+    std::unique_lock<std::mutex> lock(m_mtx);
+    int index = -1;
+    bool success = args->term() <= m_currentTerm && leaderReadIndex(&lock, deadline, &index);
+    reply->set_term(m_currentTerm);
+    reply->set_success(success);
+    reply->set_readindex(index);
+}
+
+void Raft::ReadIndex(google::protobuf::RpcController * /*controller*/, const ::raftRpcProto::ReadIndexArgs *request,
+                     ::raftRpcProto::ReadIndexReply *response, ::google::protobuf::Closure *done)
+{
+    ReadIndex(request, response);
+    done->Run();
+}
+
+// 调用前需要持有m_mtx
+// 多数节点都回复过的最大轮次，leader自己算作已回复最新一轮
+int64_t Raft::readRoundConfirmed()
+{
+    return m_config.QuorumValue([&](int id) { return id == m_me ? m_readRoundSeq : m_peerAckRound[id]; });
+}
+
+// 调用前需要持有m_mtx
+// follower至少要等minRandomizedElectionTime没有收到心跳才会发起选举，
+// 减去时钟偏差之后，最近一次被多数确认的轮次开始后的这段时间内不会有新leader
+bool Raft::leaseValid()
+{
+    // 领导权转移期间和发出TimeoutNow之后，本来有效的租约也可能被目标节点的选举提前打破
+    if (m_leadTransferee != -1 || now() < m_leaseBlockedUntil)
+        return false;
+    auto it = m_readRoundStartTime.find(readRoundConfirmed());
+    if (it == m_readRoundStartTime.end())
+        return false;
+    return now() - it->second < std::chrono::milliseconds(minRandomizedElectionTime - LEASE_MAX_CLOCK_DRIFT);
+}
+
+void Raft::GetLeaseReadStats(long long *leaseReads, long long *fallbackReads)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    *leaseReads = m_leaseReadCount;
+    *fallbackReads = m_leaseFallbackCount;
+}
+
+bool Raft::TransferLeadership(int target)
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    if (m_status != Leader || !m_config.IsVoter(target) || m_config.IsWitness(target) || target == m_me ||
+        m_leadTransferee != -1 || m_peers[target] == nullptr)
+        return false;
+
+    int term = m_currentTerm;
+    m_leadTransferee = target;
+    refreshProposalGate();
+    // 关闭入口之前已经分配了logIndex的提案先追加，之后不再有新日志
+    flushProposals();
+    // 和etcd一样，一个选举超时之内没有完成就放弃
+    m_leadTransferDeadline = now() + std::chrono::milliseconds(minRandomizedElectionTime);
+    DPrintf("[func-TransferLeadership-rf{%d}] 开始把term{%d}的领导权转移给节点{%d}", m_me, term, target);
+
+    // 不再有新日志，target追上当前的最后一条就和自己一样新了
+    while (m_matchIndex[target] < getLastLogIndex())
+    {
+        if (m_status != Leader || m_currentTerm != term || now() >= m_leadTransferDeadline ||
+            !m_config.IsVoter(target))
+        {
+            if (m_status == Leader && m_currentTerm == term)
+            {
+                m_leadTransferee = -1;
+                refreshProposalGate();
+            }
+            return false;
+        }
+        leaderSendAppendEntries(target, false);
+        waitFor(m_transferCond, lock, std::chrono::milliseconds(HeartBeatTimeout));
+    }
+
+    raftRpcProto::TimeoutNowArgs args;
+    raftRpcProto::TimeoutNowReply reply;
+    args.set_term(term);
+    args.set_leaderid(m_me);
+    args.set_groupid(m_groupId);
+    std::shared_ptr<RaftRpcUtil> peer = m_peers[target];
+    // 不管TimeoutNow是否成功送达，之前确认的租约最晚到这时也过期了
+    m_leaseBlockedUntil = now() + std::chrono::milliseconds(minRandomizedElectionTime);
+    lock.unlock();
+    bool ok = peer->TimeoutNow(&args, &reply);
+    lock.lock();
+    if (!ok || !reply.success())
+    {
+        if (m_status == Leader && m_currentTerm == term)
+        {
+            m_leadTransferee = -1;
+            refreshProposalGate();
+        }
+        return false;
+    }
+    // 之后target用更大的term发起选举，自己收到请求后退回follower；
+    // 如果它没能当选，doHeartBeat在期限过后恢复接受日志
+    return true;
+}
+
+// 不经过预投票和选举超时，直接用下一个term发起选举
+void Raft::TimeoutNow(const raftRpcProto::TimeoutNowArgs *args, raftRpcProto::TimeoutNowReply *reply)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (args->term() < m_currentTerm || m_status == Leader || !m_config.IsVoter(m_me) || m_config.IsWitness(m_me))
+    {
+        reply->set_term(m_currentTerm);
+        reply->set_success(false);
+        return;
+    }
+    if (args->term() > m_currentTerm)
+    {
+        m_status = Follower;
+        m_currentTerm = args->term();
+        m_votedFor = -1;
+    }
+    DPrintf("[func-TimeoutNow-rf{%d}] 收到leader{%d}的TimeoutNow，立即发起term{%d}的选举", m_me, args->leaderid(),
+            m_currentTerm + 1);
+    reply->set_term(m_currentTerm);
+    reply->set_success(true);
+    startElection();
+}
+
+void Raft::TimeoutNow(google::protobuf::RpcController * /*controller*/, const ::raftRpcProto::TimeoutNowArgs *request,
+                      ::raftRpcProto::TimeoutNowReply *response, ::google::protobuf::Closure *done)
+{
+    TimeoutNow(request, response);
+    done->Run();
+}
+
+// 调用前需要持有m_mtx
+// 变更日志和普通提案一样追加，但不等攒批窗口，直接发出
+bool Raft::proposeConfChange(const raftRpcProto::ConfChange &cc)
+{
+    if (m_status != Leader || m_leadTransferee != -1)
+        return false;
+    // 上一个变更还没有提交
+    if (m_pendingConfIndex > m_commitIndex)
+        return false;
+    if (!m_config.Valid(cc))
+        return false;
+    if (cc.type() == raftRpcProto::ConfAddLearner || cc.type() == raftRpcProto::ConfAddWitness)
+    {
+        // 新节点要么启动时就有连接，要么带上地址
+        int id = cc.nodeid();
+        bool hasAddr = std::any_of(cc.addrs().begin(), cc.addrs().end(),
+                                   [id](const raftRpcProto::PeerAddr &addr) { return addr.nodeid() == id; });
+        if (id == m_me || (!hasAddr && (id >= static_cast<int>(m_peers.size()) || m_peers[id] == nullptr)))
+            return false;
+    }
+
+    // 变更日志排在已经分配了logIndex的提案之后
+    raftRpcProto::LogEntry newLogEntry;
+    newLogEntry.set_command(cc.SerializeAsString());
+    newLogEntry.set_type(raftRpcProto::EntryConfChange);
+    appendLeaderEntry(&newLogEntry);
+    m_pendingConfIndex = newLogEntry.logindex();
+    DPrintf("[func-proposeConfChange-rf{%d}] 在logIndex{%d}追加成员变更：type{%d}", m_me, newLogEntry.logindex(),
+            cc.type());
+    flushProposals();
+    return true;
+}
+
+// 调用前需要持有m_mtx
+bool Raft::learnerCaughtUp(int server)
+{
+    return m_config.IsLearner(server) && m_matchIndex[server] + LEARNER_CATCHUP_MAX_LAG >= getLastLogIndex();
+}
+
+bool Raft::AddLearner(int server)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    return proposeConfChange(newMemberChange(raftRpcProto::ConfAddLearner, server, nullptr));
+}
+
+bool Raft::AddLearner(int server, const std::string &ip, short port)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    raftRpcProto::PeerAddr addr;
+    addr.set_ip(ip);
+    addr.set_port(port);
+    return proposeConfChange(newMemberChange(raftRpcProto::ConfAddLearner, server, &addr));
+}
+
+bool Raft::AddWitness(int server)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    return proposeConfChange(newMemberChange(raftRpcProto::ConfAddWitness, server, nullptr));
+}
+
+bool Raft::AddWitness(int server, const std::string &ip, short port)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    raftRpcProto::PeerAddr addr;
+    addr.set_ip(ip);
+    addr.set_port(port);
+    return proposeConfChange(newMemberChange(raftRpcProto::ConfAddWitness, server, &addr));
+}
+
+// addr为nullptr表示启动时就有到server的连接
+raftRpcProto::ConfChange Raft::newMemberChange(raftRpcProto::ConfChangeType type, int server,
+                                               const raftRpcProto::PeerAddr *addr)
+{
+    raftRpcProto::ConfChange cc;
+    cc.set_type(type);
+    cc.set_nodeid(server);
+    if (addr != nullptr)
+    {
+        auto *peerAddr = cc.add_addrs();
+        *peerAddr = *addr;
+        peerAddr->set_nodeid(server);
+    }
+    return cc;
+}
+
+bool Raft::PromoteLearner(int server)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    // 还在追赶的learner成为voter后，提交要等它追上，所以先检查进度
+    if (m_status != Leader || !learnerCaughtUp(server))
+        return false;
+    raftRpcProto::ConfChange cc;
+    cc.set_type(raftRpcProto::ConfPromoteLearner);
+    cc.set_nodeid(server);
+    return proposeConfChange(cc);
+}
+
+bool Raft::RemoveLearner(int server)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    raftRpcProto::ConfChange cc;
+    cc.set_type(raftRpcProto::ConfRemoveLearner);
+    cc.set_nodeid(server);
+    return proposeConfChange(cc);
+}
+
+bool Raft::ChangeVoters(const std::vector<int> &voters)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    if (m_status != Leader)
+        return false;
+    // 新的voter只能来自已经追上的learner，过渡期间的提交不会被还在追赶的节点拖住
+    for (int id : voters)
+    {
+        if (!m_config.IsVoter(id) && !learnerCaughtUp(id))
+            return false;
+    }
+    raftRpcProto::ConfChange cc;
+    cc.set_type(raftRpcProto::ConfEnterJoint);
+    for (int id : voters)
+        cc.add_voters(id);
+    return proposeConfChange(cc);
+}
+
+RaftConfig Raft::GetConfig()
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    return m_config;
+}
+
+void Raft::init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::shared_ptr<Persister> persister,
+                std::shared_ptr<LockQueue<ApplyMsg>> applyCh)
+{
+    init(peers, me, persister, applyCh, RaftConfig::AllVoters(peers.size()));
+}
+
+void Raft::init(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::shared_ptr<Persister> persister,
+                std::shared_ptr<LockQueue<ApplyMsg>> applyCh, const RaftConfig &bootstrap)
+{
+    m_groupId = 0;
+    m_heartBeatCoalescer = nullptr;
+    initState(peers, me, persister, applyCh, bootstrap);
+
+    // 两个定时器跑在协程中
+    m_ioManager = std::make_unique<monsoon::IOManager>(FIBER_THREAD_NUM, FIBER_USE_CALLER_THREAD);
+    m_ioManager->scheduler([this]() -> void { this->leaderHearBeatTicker(); });
+    m_ioManager->scheduler([this]() -> void { this->electionTimeOutTicker(); });
+
+    // applier和提案攒批在条件变量上阻塞，用单独的线程
+    std::thread t3(&Raft::applierTicker, this);
+    t3.detach();
+    std::thread t4(&Raft::proposalBatcher, this);
+    t4.detach();
+}
+
+void Raft::initGroup(int groupId, std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me,
+                     std::shared_ptr<Persister> persister, std::shared_ptr<LockQueue<ApplyMsg>> applyCh,
+                     HeartBeatCoalescer *heartBeatCoalescer)
+{
+    m_groupId = groupId;
+    m_heartBeatCoalescer = heartBeatCoalescer;
+    initState(peers, me, persister, applyCh, RaftConfig::AllVoters(peers.size()));
+}
+
+void Raft::initState(std::vector<std::shared_ptr<RaftRpcUtil>> peers, int me, std::shared_ptr<Persister> persister,
+                     std::shared_ptr<LockQueue<ApplyMsg>> applyCh, const RaftConfig &bootstrap)
+{
+    m_peers = peers;
+    m_persister = persister;
+    m_me = me;
+
+    m_mtx.lock();
+    this->applyChan = applyCh;
+    m_currentTerm = 0;
+    m_status = Follower;
+    m_commitIndex = 0;
+    m_lastApplied = 0;
+    m_pendingSnapshotMsg = nullptr;
+    m_logs.clear();
+    m_votedFor = -1;
+    m_leaderId = -1;
+    // 有持久化的配置时readPersist会覆盖
+    m_config = bootstrap;
+    m_pendingConfIndex = 0;
+    m_lastSnapshotIncludeIndex = 0;
+    m_lastSnapshotIncludeTerm = 0;
+    m_lastResetElectionTime = now();
+    m_lastResetHearBeatTime = now();
+    m_electionTimeout = getRandomizedElectionTimeout();
+
+    // 每个节点一份的复制状态
+    m_nextIndex.assign(m_peers.size(), 0);
+    m_matchIndex.assign(m_peers.size(), 0);
+    m_inflightCount.assign(m_peers.size(), 0);
+    m_inflightBytes.assign(m_peers.size(), 0);
+    m_inflightEpoch.assign(m_peers.size(), 0);
+    m_inflightEpochSeq = 0;
+    m_inflightProgressTime.assign(m_peers.size(), now());
+    m_peerAckRound.assign(m_peers.size(), 0);
+    m_snapshotSending.assign(m_peers.size(), false);
+    m_appendQueue.assign(m_peers.size(), {});
+    m_appendSending.assign(m_peers.size(), false);
+    m_asyncTasks = 0;
+    m_shutdown = false;
+    m_progressState.assign(m_peers.size(), ProgressProbe);
+
+    m_readRoundSeq = 0;
+    m_readRoundWanted = 0;
+    m_readRoundStartTime.clear();
+    m_leaseReadCount = 0;
+    m_leaseFallbackCount = 0;
+    m_leadTransferee = -1;
+    m_leadTransferDeadline = now();
+    m_leaseBlockedUntil = now();
+    m_snapshotRecvIndex = -1;
+    m_snapshotRecvTerm = -1;
+    m_snapshotRecvOffset = 0;
+    m_proposalOpen = false;
+    m_proposalTerm = 0;
+    m_proposalNextIndex = 0;
+    m_proposalQueue.clear();
+    m_proposalQueueBytes = 0;
+    m_firstPendingProposalTime = now();
+    m_lastProposalFlushTime = now();
+
+    // 持久化状态：各字段设为不可能的值，保证第一次persist一定写入
+    m_persistedHardState = RaftPersistHeader{-1, -1, -1, -1, -1, ""};
+    m_logDirtyFrom = INT_MAX;
+    m_walLastIndex = -1;
+    m_persistedLogIndex = 0;
+
+    // 从崩溃中恢复
+    readPersist(m_persister->ReadRaftState());
+    if (m_lastSnapshotIncludeIndex > 0)
+        m_lastApplied = m_lastSnapshotIncludeIndex;
+    // 持久化的配置中可能有运行期间加入的节点，建立到它们的连接
+    syncPeers(RaftConfig());
+
+    DPrintf("[Init&ReInit] Sever %d, term %d, lastSnapshotIncludeIndex {%d} , lastSnapshotIncludeTerm {%d}", m_me,
+            m_currentTerm, m_lastSnapshotIncludeIndex, m_lastSnapshotIncludeTerm);
+    m_mtx.unlock();
+}
+
+bool Raft::tick()
+{
+    bool heartBeatDue = false;
+    bool electionDue = false;
+    bool proposalDue = false;
+    std::vector<ApplyMsg> applyMsgs;
+    {
+        std::lock_guard<std::mutex> lg(m_mtx);
+        if (m_shutdown)
+            return false;
+        auto nowTime = now();
+        if (m_status == Leader)
+        {
+            heartBeatDue = nowTime - m_lastResetHearBeatTime >= std::chrono::milliseconds(HeartBeatTimeout);
+        }
+        else if (nowTime - m_lastResetElectionTime >= m_electionTimeout)
+        {
+            electionDue = true;
+            m_electionTimeout = getRandomizedElectionTimeout();
+        }
+        {
+            std::lock_guard<std::mutex> proposalLock(m_proposalMtx);
+            proposalDue = !m_proposalQueue.empty() &&
+                          nowTime - m_firstPendingProposalTime >= std::chrono::microseconds(PROPOSAL_BATCH_WINDOW_US);
+        }
+        if (proposalDue)
+            flushProposals();
+        if (hasApplyWork())
+        {
+            applyMsgs = getApplyLogs();
+            m_readCond.notify_all();
+        }
+    }
+    if (heartBeatDue)
+        doHeartBeat();
+    if (electionDue)
+        doElection();
+    for (auto &message : applyMsgs)
+        applyChan->Push(message);
+    return heartBeatDue || electionDue || proposalDue || !applyMsgs.empty();
+}
+
+void Raft::Shutdown()
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    m_shutdown = true;
+    // 不再是leader，新的提案和读请求都会被拒绝，等待中的读请求和领导权转移也被唤醒
+    m_status = Follower;
+    m_leaderId = -1;
+    refreshProposalGate();
+    m_readCond.notify_all();
+    m_transferCond.notify_all();
+    waitCond(m_asyncTasksCond, lock, [&]() { return m_asyncTasks == 0; });
+    DPrintf("[func-Raft::Shutdown-rf{%d}] raft组{%d}已停止", m_me, m_groupId);
+}
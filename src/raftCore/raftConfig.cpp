@@ -0,0 +1,192 @@
+#include "include/raftConfig.h"
+#include <algorithm>
+#include <vector>
+
+RaftConfig::RaftConfig() : m_index(0) {}
+
+RaftConfig RaftConfig::AllVoters(int peerCount, const std::set<int> &witnesses)
+{
+    RaftConfig config;
+    for (int i = 0; i < peerCount; i++)
+        config.m_voters.insert(i);
+    for (int id : witnesses)
+    {
+        if (config.IsVoter(id))
+            config.m_witnesses.insert(id);
+    }
+    return config;
+}
+
+std::set<int> RaftConfig::Members() const
+{
+    std::set<int> members(m_voters);
+    members.insert(m_outgoing.begin(), m_outgoing.end());
+    members.insert(m_learners.begin(), m_learners.end());
+    return members;
+}
+
+bool RaftConfig::Valid(const raftRpcProto::ConfChange &cc) const
+{
+    switch (cc.type())
+    {
+        case raftRpcProto::ConfAddLearner:
+        case raftRpcProto::ConfAddWitness:
+            return !Joint() && cc.nodeid() >= 0 && !Contains(cc.nodeid());
+        case raftRpcProto::ConfPromoteLearner:
+        case raftRpcProto::ConfRemoveLearner:
+            return !Joint() && IsLearner(cc.nodeid());
+        case raftRpcProto::ConfEnterJoint:
+        {
+            if (Joint() || cc.voters_size() == 0)
+                return false;
+            std::set<int> voters(cc.voters().begin(), cc.voters().end());
+            if (*voters.begin() < 0 || static_cast<int>(voters.size()) != cc.voters_size())
+                return false;
+            return voters != m_voters;
+        }
+        case raftRpcProto::ConfLeaveJoint:
+            return Joint();
+        default:
+            return false;
+    }
+}
+
+bool RaftConfig::Apply(const raftRpcProto::ConfChange &cc, int logIndex)
+{
+    m_index = logIndex;
+    if (!Valid(cc))
+        return false;
+    for (const auto &addr : cc.addrs())
+        m_addrs[addr.nodeid()] = addr;
+    switch (cc.type())
+    {
+        case raftRpcProto::ConfAddLearner:
+            m_learners.insert(cc.nodeid());
+            break;
+        case raftRpcProto::ConfPromoteLearner:
+            m_learners.erase(cc.nodeid());
+            m_voters.insert(cc.nodeid());
+            break;
+        case raftRpcProto::ConfRemoveLearner:
+            m_learners.erase(cc.nodeid());
+            break;
+        case raftRpcProto::ConfEnterJoint:
+            m_outgoing = m_voters;
+            m_voters = std::set<int>(cc.voters().begin(), cc.voters().end());
+            // 被提升为voter的learner不再是learner
+            for (int id : m_voters)
+                m_learners.erase(id);
+            break;
+        case raftRpcProto::ConfLeaveJoint:
+            m_outgoing.clear();
+            break;
+        case raftRpcProto::ConfAddWitness:
+            // witness没有数据需要追赶，直接作为voter加入
+            m_voters.insert(cc.nodeid());
+            m_witnesses.insert(cc.nodeid());
+            break;
+        default:
+            break;
+    }
+    // 被移出voter集合的witness不再是witness，witness不能变成learner
+    for (auto it = m_witnesses.begin(); it != m_witnesses.end();)
+    {
+        if (IsVoter(*it))
+            ++it;
+        else
+            it = m_witnesses.erase(it);
+    }
+    // 已经不在配置中的节点不再需要地址
+    for (auto it = m_addrs.begin(); it != m_addrs.end();)
+    {
+        if (Contains(it->first))
+            ++it;
+        else
+            it = m_addrs.erase(it);
+    }
+    return true;
+}
+
+bool RaftConfig::hasQuorum(const std::set<int> &voters, const std::function<bool(int)> &acked)
+{
+    int sum = 0;
+    for (int id : voters)
+    {
+        if (acked(id))
+            sum += 1;
+    }
+    return sum >= static_cast<int>(voters.size()) / 2 + 1;
+}
+
+bool RaftConfig::HasQuorum(const std::function<bool(int)> &acked) const
+{
+    if (m_voters.empty())
+        return false;
+    return hasQuorum(m_voters, acked) && (!Joint() || hasQuorum(m_outgoing, acked));
+}
+
+int64_t RaftConfig::quorumValue(const std::set<int> &voters, const std::function<int64_t(int)> &value)
+{
+    std::vector<int64_t> values;
+    values.reserve(voters.size());
+    for (int id : voters)
+        values.push_back(value(id));
+    int quorum = voters.size() / 2 + 1;
+    std::nth_element(values.begin(), values.begin() + (quorum - 1), values.end(), std::greater<int64_t>());
+    return values[quorum - 1];
+}
+
+int64_t RaftConfig::QuorumValue(const std::function<int64_t(int)> &value) const
+{
+    if (m_voters.empty())
+        return -1;
+    int64_t result = quorumValue(m_voters, value);
+    if (Joint())
+        result = std::min(result, quorumValue(m_outgoing, value));
+    return result;
+}
+
+void RaftConfig::ToProto(raftRpcProto::ClusterConfig *config) const
+{
+    config->Clear();
+    for (int id : m_voters)
+        config->add_voters(id);
+    for (int id : m_learners)
+        config->add_learners(id);
+    for (int id : m_outgoing)
+        config->add_outgoingvoters(id);
+    for (int id : m_witnesses)
+        config->add_witnesses(id);
+    for (const auto &addr : m_addrs)
+        *config->add_addrs() = addr.second;
+    config->set_index(m_index);
+}
+
+RaftConfig RaftConfig::FromProto(const raftRpcProto::ClusterConfig &config)
+{
+    RaftConfig result;
+    result.m_voters.insert(config.voters().begin(), config.voters().end());
+    result.m_learners.insert(config.learners().begin(), config.learners().end());
+    result.m_outgoing.insert(config.outgoingvoters().begin(), config.outgoingvoters().end());
+    result.m_witnesses.insert(config.witnesses().begin(), config.witnesses().end());
+    for (const auto &addr : config.addrs())
+        result.m_addrs[addr.nodeid()] = addr;
+    result.m_index = config.index();
+    return result;
+}
+
+std::string RaftConfig::Encode() const
+{
+    raftRpcProto::ClusterConfig config;
+    ToProto(&config);
+    return config.SerializeAsString();
+}
+
+bool RaftConfig::Decode(const std::string &data, RaftConfig *config)
+{
+    raftRpcProto::ClusterConfig proto;
+    if (!proto.ParseFromString(data))
+        return false;
+    *config = FromProto(proto);
+    return true;
+}
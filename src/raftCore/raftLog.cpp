@@ -0,0 +1,68 @@
+#include "include/raftLog.h"
+
+RaftLog::RaftLog() : m_head(0), m_size(0) {}
+
+void RaftLog::push_back(const raftRpcProto::LogEntry &entry)
+{
+    reserveTail();
+    m_blocks.back()->push_back(entry);
+    ++m_size;
+}
+
+void RaftLog::push_back(raftRpcProto::LogEntry &&entry)
+{
+    reserveTail();
+    m_blocks.back()->push_back(std::move(entry));
+    ++m_size;
+}
+
+void RaftLog::clear()
+{
+    m_blocks.clear();
+    m_head = 0;
+    m_size = 0;
+}
+
+void RaftLog::truncatePrefix(size_t n)
+{
+    if (n >= m_size)
+    {
+        clear();
+        return;
+    }
+    m_head += n;
+    m_size -= n;
+    // 整块都已经被截掉的直接释放
+    while (m_head >= kBlockSize)
+    {
+        m_blocks.pop_front();
+        m_head -= kBlockSize;
+    }
+}
+
+void RaftLog::truncateSuffix(size_t n)
+{
+    if (n >= m_size)
+        return;
+    if (n == 0)
+    {
+        clear();
+        return;
+    }
+    size_t end = m_head + n;
+    size_t blockCount = (end + kBlockSize - 1) / kBlockSize;
+    while (m_blocks.size() > blockCount)
+        m_blocks.pop_back();
+    // 最后一块只保留前面的部分，resize变小不会重新分配，前面条目的引用仍然有效
+    m_blocks.back()->resize(end - (blockCount - 1) * kBlockSize);
+    m_size = n;
+}
+
+void RaftLog::reserveTail()
+{
+    if (m_blocks.empty() || m_blocks.back()->size() == kBlockSize)
+    {
+        m_blocks.emplace_back(new Block());
+        m_blocks.back()->reserve(kBlockSize);
+    }
+}
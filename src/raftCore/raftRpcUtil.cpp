@@ -2,29 +2,101 @@
 #include "../rpc/include/mprpcchannel.h"
 #include "../rpc/include/mprpccontroller.h"
 
+RaftRpcUtil::Connection *RaftRpcUtil::acquire(bool ordered, std::unique_lock<std::mutex> *lock)
+{
+    // 只有一条连接时所有请求都走它
+    if (ordered || conns_.size() == 1)
+    {
+        *lock = std::unique_lock<std::mutex>(conns_[0]->mtx);
+        return conns_[0].get();
+    }
+    size_t unordered = conns_.size() - 1;
+    unsigned start = next_++;
+    for (size_t i = 0; i < unordered; ++i)
+    {
+        Connection *conn = conns_[1 + (start + i) % unordered].get();
+        std::unique_lock<std::mutex> tryLock(conn->mtx, std::try_to_lock);
+        if (tryLock.owns_lock())
+        {
+            *lock = std::move(tryLock);
+            return conn;
+        }
+    }
+    Connection *conn = conns_[1 + start % unordered].get();
+    *lock = std::unique_lock<std::mutex>(conn->mtx);
+    return conn;
+}
+
 bool RaftRpcUtil::AppendEntries(raftRpcProto::AppendEntriesArgs *args, raftRpcProto::AppendEntriesReply *response)
 {
+    std::unique_lock<std::mutex> lock;
+    Connection *conn = acquire(true, &lock);
     MpRpcController controller;
-    stub_->AppendEntries(&controller, args, response, nullptr);
+    conn->stub->AppendEntries(&controller, args, response, nullptr);
     return !controller.Failed();
 }
 
 bool RaftRpcUtil::InstallSnapshot(raftRpcProto::InstallSnapshotRequest *args, raftRpcProto::InstallSnapshotResponse *response)
 {
+    std::unique_lock<std::mutex> lock;
+    Connection *conn = acquire(false, &lock);
     MpRpcController controller;
-    stub_->InstallSnapshot(&controller, args, response, nullptr);
+    conn->stub->InstallSnapshot(&controller, args, response, nullptr);
+    return !controller.Failed();
 }
 
 bool RaftRpcUtil::RequestVote(raftRpcProto::RequestVoteArgs *args, raftRpcProto::RequestVoteReply *response)
 {
+    std::unique_lock<std::mutex> lock;
+    Connection *conn = acquire(false, &lock);
+    MpRpcController controller;
+    conn->stub->RequestVote(&controller, args, response, nullptr);
+    return !controller.Failed();
+}
+
+bool RaftRpcUtil::ReadIndex(raftRpcProto::ReadIndexArgs *args, raftRpcProto::ReadIndexReply *response)
+{
+    std::unique_lock<std::mutex> lock;
+    Connection *conn = acquire(false, &lock);
+    MpRpcController controller;
+    conn->stub->ReadIndex(&controller, args, response, nullptr);
+    return !controller.Failed();
+}
+
+bool RaftRpcUtil::TimeoutNow(raftRpcProto::TimeoutNowArgs *args, raftRpcProto::TimeoutNowReply *response)
+{
+    std::unique_lock<std::mutex> lock;
+    Connection *conn = acquire(false, &lock);
     MpRpcController controller;
-    stub_->RequestVote(&controller, args, response, nullptr);
+    conn->stub->TimeoutNow(&controller, args, response, nullptr);
     return !controller.Failed();
 }
 
-RaftRpcUtil::RaftRpcUtil(std::string ip, short port)
+bool RaftRpcUtil::BatchAppendEntries(raftRpcProto::BatchAppendEntriesArgs *args,
+                                     raftRpcProto::BatchAppendEntriesReply *response)
 {
-    stub_ = new raftRpcProto::raftRpc_Stub(new MpRpcChannel(ip, port, true));
+    std::unique_lock<std::mutex> lock;
+    Connection *conn = acquire(true, &lock);
+    MpRpcController controller;
+    conn->stub->BatchAppendEntries(&controller, args, response, nullptr);
+    return !controller.Failed();
 }
 
-RaftRpcUtil::~RaftRpcUtil() { delete stub_; }
\ No newline at end of file
+RaftRpcUtil::RaftRpcUtil(std::string ip, short port, int connections, bool lazy) : next_(0)
+{
+    for (int i = 0; i < std::max(connections, 1); ++i)
+    {
+        auto conn = std::make_unique<Connection>();
+        // 只有有序连接立即建立，其余的在第一次使用时再连接
+        conn->stub = new raftRpcProto::raftRpc_Stub(new MpRpcChannel(ip, port, i == 0 && !lazy));
+        conns_.push_back(std::move(conn));
+    }
+}
+
+RaftRpcUtil::RaftRpcUtil() : next_(0) {}
+
+RaftRpcUtil::~RaftRpcUtil()
+{
+    for (auto &conn : conns_)
+        delete conn->stub;
+}
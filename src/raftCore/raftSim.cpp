@@ -0,0 +1,515 @@
+#include "include/raftSim.h"
+#include <algorithm>
+#include <thread>
+#include "include/Persister.h"
+#include "include/raftConfig.h"
+
+// 当前线程和虚拟时钟的关系，线程退出时从时钟上注销
+struct SimThread
+{
+    SimClock *clock = nullptr;
+    // Spawn启动的任务
+    bool task = false;
+    // 模拟器线程，推进时间的线程自己不能停下等待
+    bool driver = false;
+
+    ~SimThread()
+    {
+        if (clock != nullptr)
+            clock->threadExit(task);
+    }
+};
+
+namespace
+{
+thread_local SimThread t_simThread;
+
+// splitmix64，把(种子, 链路, 序号)打散成一个随机数
+uint64_t mix(uint64_t x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+}
+
+SimClock::SimClock(std::chrono::microseconds settle)
+    : m_now(std::chrono::hours(24)), m_settle(settle), m_stopped(false), m_running(0), m_tasks(0), m_activity(0), m_idleActivity(0)
+{
+}
+
+std::chrono::_V2::system_clock::time_point SimClock::Now()
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    return m_now;
+}
+
+bool SimClock::park()
+{
+    SimThread &self = t_simThread;
+    if (self.driver)
+    {
+        // 模拟器线程停下就没有人推进时间了，只有结束模拟之后才允许
+        myAssert(m_stopped, "[func-SimClock::park] 模拟器线程不能在虚拟时钟上等待");
+        return false;
+    }
+    // 第一次在时钟上等待的线程（比如落盘线程）从此被跟踪
+    if (self.clock == nullptr)
+    {
+        self.clock = this;
+        ++m_running;
+    }
+    --m_running;
+    ++m_activity;
+    m_idleCond.notify_all();
+    return true;
+}
+
+void SimClock::unpark(bool tracked)
+{
+    if (!tracked)
+        return;
+    ++m_running;
+    ++m_activity;
+    m_idleCond.notify_all();
+}
+
+bool SimClock::busy()
+{
+    if (m_running > 0)
+        return true;
+    return (!m_sleepers.empty() && *m_sleepers.begin() <= m_now) ||
+           (!m_waiters.empty() && m_waiters.begin()->first <= m_now);
+}
+
+void SimClock::threadExit(bool task)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    --m_running;
+    if (task)
+        --m_tasks;
+    ++m_activity;
+    m_idleCond.notify_all();
+}
+
+void SimClock::SleepFor(std::chrono::microseconds duration)
+{
+    std::unique_lock<std::mutex> lock(m_mtx);
+    auto deadline = m_now + duration;
+    if (m_stopped)
+    {
+        // 结束之后没有人推进时间，直接跳到到期时刻，否则按虚拟时间循环等待的线程永远等不到超时
+        m_now = std::max(m_now, deadline);
+        return;
+    }
+    if (m_now >= deadline)
+        return;
+    auto it = m_sleepers.insert(deadline);
+    bool tracked = park();
+    m_sleepCond.wait(lock, [&]() { return m_now >= deadline || m_stopped; });
+    m_sleepers.erase(it);
+    unpark(tracked);
+}
+
+void SimClock::WaitUntil(std::condition_variable &cond, std::unique_lock<std::mutex> &lock,
+                         std::chrono::_V2::system_clock::time_point deadline)
+{
+    auto waiter = std::make_shared<Waiter>(Waiter{&cond, lock.mutex()});
+    std::multimap<std::chrono::_V2::system_clock::time_point, std::shared_ptr<Waiter>>::iterator it;
+    bool tracked = false;
+    {
+        std::lock_guard<std::mutex> lg(m_mtx);
+        if (m_stopped)
+        {
+            m_now = std::max(m_now, deadline);
+            return;
+        }
+        if (m_now >= deadline)
+            return;
+        it = m_waiters.emplace(deadline, waiter);
+        tracked = park();
+    }
+    // 注册时持有lock，AdvanceTo要拿到lock才能notify，所以到期的唤醒不会在wait之前丢失
+    cond.wait(lock);
+    std::lock_guard<std::mutex> lg(m_mtx);
+    m_waiters.erase(it);
+    unpark(tracked);
+}
+
+void SimClock::Wait(std::condition_variable &cond, std::unique_lock<std::mutex> &lock)
+{
+    bool tracked = false;
+    {
+        std::lock_guard<std::mutex> lg(m_mtx);
+        tracked = park();
+    }
+    cond.wait(lock);
+    std::lock_guard<std::mutex> lg(m_mtx);
+    unpark(tracked);
+}
+
+void SimClock::Spawn(std::function<void()> task)
+{
+    {
+        // 在线程真正运行之前就计入，模拟器不会在任务发出rpc之前推进时间
+        std::lock_guard<std::mutex> lg(m_mtx);
+        ++m_running;
+        ++m_tasks;
+        ++m_activity;
+    }
+    std::thread t(
+        [this, task]()
+        {
+            t_simThread.clock = this;
+            t_simThread.task = true;
+            task();
+        });
+    t.detach();
+}
+
+void SimClock::WaitIdle()
+{
+    t_simThread.driver = true;
+    std::unique_lock<std::mutex> lock(m_mtx);
+    while (true)
+    {
+        m_idleCond.wait(lock, [&]() { return !busy(); });
+        // 上次停下之后什么都没有发生，大多数空闲的tick走这里
+        if (m_activity == m_idleActivity)
+            return;
+        // 被别的线程notify、还没醒来的线程仍算作停下，观察一小段真实时间确认没有新的活动。
+        // 这段时间很短，用yield而不是带超时的wait，后者会被内核的定时器松弛拉长到几十微秒
+        uint64_t seen = m_activity;
+        auto settleEnd = std::chrono::steady_clock::now() + m_settle;
+        while (m_activity == seen && std::chrono::steady_clock::now() < settleEnd)
+        {
+            lock.unlock();
+            std::this_thread::yield();
+            lock.lock();
+        }
+        if (m_activity == seen && !busy())
+        {
+            m_idleActivity = m_activity;
+            return;
+        }
+    }
+}
+
+void SimClock::Touch()
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    ++m_activity;
+}
+
+std::chrono::_V2::system_clock::time_point SimClock::NextDeadline()
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    auto next = std::chrono::_V2::system_clock::time_point::max();
+    if (!m_sleepers.empty())
+        next = std::min(next, *m_sleepers.begin());
+    if (!m_waiters.empty())
+        next = std::min(next, m_waiters.begin()->first);
+    return next;
+}
+
+void SimClock::AdvanceTo(std::chrono::_V2::system_clock::time_point t)
+{
+    t_simThread.driver = true;
+    std::vector<std::shared_ptr<Waiter>> expired;
+    {
+        std::lock_guard<std::mutex> lg(m_mtx);
+        m_now = std::max(m_now, t);
+        for (auto it = m_waiters.begin(); it != m_waiters.end() && it->first <= m_now; ++it)
+            expired.push_back(it->second);
+        m_sleepCond.notify_all();
+    }
+    // 等待者醒来之前一直留在m_waiters中，它的cond和mutex属于Raft等长期存在的对象
+    for (auto &waiter : expired)
+    {
+        std::lock_guard<std::mutex> lg(*waiter->mutex);
+        waiter->cond->notify_all();
+    }
+}
+
+void SimClock::Stop()
+{
+    std::vector<std::shared_ptr<Waiter>> waiters;
+    {
+        std::lock_guard<std::mutex> lg(m_mtx);
+        m_stopped = true;
+        // 跳过所有还在等待的超时，循环等待的线程看到超时后退出
+        m_now += std::chrono::hours(24);
+        for (auto &entry : m_waiters)
+            waiters.push_back(entry.second);
+        m_sleepCond.notify_all();
+    }
+    for (auto &waiter : waiters)
+    {
+        std::lock_guard<std::mutex> lg(*waiter->mutex);
+        waiter->cond->notify_all();
+    }
+    std::unique_lock<std::mutex> lock(m_mtx);
+    m_idleCond.wait(lock, [&]() { return m_tasks == 0; });
+}
+
+SimRpcUtil::SimRpcUtil(SimNetwork *network, int from, int to) : RaftRpcUtil(), m_network(network), m_from(from), m_to(to)
+{
+}
+
+bool SimRpcUtil::AppendEntries(raftRpcProto::AppendEntriesArgs *args, raftRpcProto::AppendEntriesReply *response)
+{
+    return m_network->Call(m_from, m_to, [&](Raft *raft) { raft->AppendEntries(args, response); });
+}
+
+bool SimRpcUtil::InstallSnapshot(raftRpcProto::InstallSnapshotRequest *args,
+                                 raftRpcProto::InstallSnapshotResponse *response)
+{
+    return m_network->Call(m_from, m_to, [&](Raft *raft) { raft->InstallSnapshot(args, response); });
+}
+
+bool SimRpcUtil::RequestVote(raftRpcProto::RequestVoteArgs *args, raftRpcProto::RequestVoteReply *response)
+{
+    return m_network->Call(m_from, m_to, [&](Raft *raft) { raft->RequestVote(args, response); });
+}
+
+bool SimRpcUtil::ReadIndex(raftRpcProto::ReadIndexArgs *args, raftRpcProto::ReadIndexReply *response)
+{
+    return m_network->Call(m_from, m_to, [&](Raft *raft) { raft->ReadIndex(args, response); });
+}
+
+bool SimRpcUtil::TimeoutNow(raftRpcProto::TimeoutNowArgs *args, raftRpcProto::TimeoutNowReply *response)
+{
+    return m_network->Call(m_from, m_to, [&](Raft *raft) { raft->TimeoutNow(args, response); });
+}
+
+bool SimRpcUtil::BatchAppendEntries(raftRpcProto::BatchAppendEntriesArgs * /*args*/,
+                                    raftRpcProto::BatchAppendEntriesReply * /*response*/)
+{
+    return false;
+}
+
+SimNetwork::SimNetwork(const SimOptions &options)
+    : m_options(options), m_group(options.nodes, 0), m_stopped(false), m_sent(0), m_dropped(0)
+{
+}
+
+void SimNetwork::SetNodes(std::vector<std::shared_ptr<Raft>> nodes)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    m_nodes = std::move(nodes);
+}
+
+void SimNetwork::Partition(const std::vector<std::vector<int>> &groups)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    // 不在任何组中的节点各自一个分区
+    for (int i = 0; i < static_cast<int>(m_group.size()); i++)
+        m_group[i] = static_cast<int>(groups.size()) + i;
+    for (int g = 0; g < static_cast<int>(groups.size()); g++)
+    {
+        for (int node : groups[g])
+            m_group[node] = g;
+    }
+}
+
+void SimNetwork::Heal()
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    std::fill(m_group.begin(), m_group.end(), 0);
+}
+
+void SimNetwork::SetDropRate(double dropRate)
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    m_options.dropRate = dropRate;
+}
+
+void SimNetwork::Stop()
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    m_stopped = true;
+    m_nodes.clear();
+}
+
+long long SimNetwork::Sent()
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    return m_sent;
+}
+
+long long SimNetwork::Dropped()
+{
+    std::lock_guard<std::mutex> lg(m_mtx);
+    return m_dropped;
+}
+
+bool SimNetwork::connected(int from, int to)
+{
+    return m_group[from] == m_group[to];
+}
+
+uint64_t SimNetwork::nextRandom(int from, int to)
+{
+    uint64_t seq = m_linkSeq[{from, to}]++;
+    return mix(mix(mix(m_options.seed) ^ ((uint64_t(from) << 32) | uint64_t(to))) ^ seq);
+}
+
+bool SimNetwork::Call(int from, int to, const std::function<void(Raft *)> &handler)
+{
+    std::chrono::microseconds delays[2];
+    bool lost[2];
+    {
+        std::lock_guard<std::mutex> lg(m_mtx);
+        if (m_stopped)
+            return false;
+        ++m_sent;
+        // 请求和回复各取两个随机数，顺序固定
+        for (int i = 0; i < 2; i++)
+        {
+            int span = std::max(0, m_options.maxDelayUs - m_options.minDelayUs) + 1;
+            delays[i] = std::chrono::microseconds(m_options.minDelayUs + nextRandom(from, to) % span);
+            lost[i] = (nextRandom(from, to) >> 11) * (1.0 / 9007199254740992.0) < m_options.dropRate;
+        }
+    }
+    std::chrono::microseconds timeout(m_options.rpcTimeoutUs);
+
+    sleepFor(delays[0]);
+    std::shared_ptr<Raft> target;
+    {
+        std::lock_guard<std::mutex> lg(m_mtx);
+        if (m_stopped)
+            return false;
+        // 到达时才检查分区，在途期间发生的分区也会丢掉消息
+        if (!lost[0] && connected(from, to))
+            target = m_nodes[to];
+        else
+            ++m_dropped;
+    }
+    if (target == nullptr)
+    {
+        if (timeout > delays[0])
+            sleepFor(timeout - delays[0]);
+        return false;
+    }
+
+    handler(target.get());
+    sleepFor(delays[1]);
+    {
+        std::lock_guard<std::mutex> lg(m_mtx);
+        if (m_stopped)
+            return false;
+        if (!lost[1] && connected(to, from))
+            return true;
+        ++m_dropped;
+    }
+    if (timeout > delays[0] + delays[1])
+        sleepFor(timeout - delays[0] - delays[1]);
+    return false;
+}
+
+SimCluster::SimCluster(const SimOptions &options)
+    : m_options(options),
+      m_clock(std::make_shared<SimClock>(std::chrono::microseconds(options.settleUs))),
+      m_network(options)
+{
+    setClock(m_clock);
+    setRandomSeed(options.seed);
+    // 在安装虚拟时钟之后创建，落盘线程的攒批等待和模拟的落盘耗时都按虚拟时间计算
+    m_syncer = std::make_shared<PersistSyncer>(std::chrono::microseconds(options.fsyncUs));
+    m_nextTick = m_clock->Now();
+
+    for (int i = 0; i < options.nodes; i++)
+    {
+        std::vector<std::shared_ptr<RaftRpcUtil>> peers(options.nodes);
+        for (int j = 0; j < options.nodes; j++)
+        {
+            if (j != i)
+                peers[j] = std::make_shared<SimRpcUtil>(&m_network, i, j);
+        }
+        // 状态只保存在内存中，模拟不读写文件，同一个种子的结果不受磁盘影响
+        auto persister = std::make_shared<Persister>(std::to_string(i), m_syncer, true);
+        auto applyCh = std::make_shared<LockQueue<ApplyMsg>>();
+        auto raft = std::make_shared<Raft>();
+        raft->initGroup(0, peers, i, persister, applyCh, nullptr);
+        m_applyChs.push_back(applyCh);
+        m_nodes.push_back(raft);
+    }
+    m_network.SetNodes(m_nodes);
+}
+
+SimCluster::~SimCluster()
+{
+    // 先让在途的rpc全部失败，等发送任务结束后才能销毁Raft
+    m_network.Stop();
+    m_clock->Stop();
+    m_nodes.clear();
+    m_syncer.reset();
+    setClock(nullptr);
+}
+
+bool SimCluster::step()
+{
+    m_clock->WaitIdle();
+    auto next = std::min(m_nextTick, m_clock->NextDeadline());
+    m_clock->AdvanceTo(next);
+    if (next < m_nextTick)
+        return false;
+
+    m_nextTick += std::chrono::microseconds(m_options.tickUs);
+    bool worked = false;
+    for (auto &raft : m_nodes)
+        worked = raft->tick() || worked;
+    for (int i = 0; i < static_cast<int>(m_applyChs.size()); i++)
+    {
+        ApplyMsg msg;
+        while (m_applyChs[i]->timeOutPop(0, &msg))
+        {
+            if (m_applyCallback)
+                m_applyCallback(i, msg);
+        }
+    }
+    if (worked)
+        m_clock->Touch();
+    return true;
+}
+
+void SimCluster::RunFor(std::chrono::microseconds duration, const std::function<bool()> &onTick)
+{
+    auto end = m_clock->Now() + duration;
+    while (m_clock->Now() < end)
+    {
+        if (step() && onTick && onTick())
+            m_clock->Touch();
+    }
+}
+
+bool SimCluster::RunUntil(const std::function<bool()> &cond, std::chrono::microseconds timeout)
+{
+    auto end = m_clock->Now() + timeout;
+    while (!cond())
+    {
+        if (m_clock->Now() >= end)
+            return false;
+        step();
+    }
+    return true;
+}
+
+int SimCluster::Leader()
+{
+    int leader = -1;
+    int leaderTerm = -1;
+    for (int i = 0; i < static_cast<int>(m_nodes.size()); i++)
+    {
+        int term = 0;
+        bool isLeader = false;
+        m_nodes[i]->GetState(&term, &isLeader);
+        if (isLeader && term > leaderTerm)
+        {
+            leader = i;
+            leaderTerm = term;
+        }
+    }
+    return leader;
+}
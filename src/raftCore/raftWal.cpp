@@ -0,0 +1,385 @@
+#include "include/raftWal.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include "../common/include/config.h"
+#include "../common/include/util.h"
+
+namespace
+{
+    // 记录头：commandLen + checksum + logIndex + logTerm
+    constexpr size_t kRecordHeaderSize = 16;
+    // commandLen的高8位保存日志类型，旧记录的高8位都是0，即EntryNormal
+    constexpr int kEntryTypeShift = 24;
+    constexpr uint32_t kCommandLenMask = (1u << kEntryTypeShift) - 1;
+    // checksum从logIndex开始计算
+    constexpr size_t kChecksumOffset = 8;
+    const char *const kSegmentSuffix = ".wal";
+}
+
+RaftWal::RaftWal(const std::string &dir) : m_dir(dir), m_activeFd(-1)
+{
+    recover();
+}
+
+RaftWal::~RaftWal()
+{
+    if (m_activeFd != -1)
+        ::close(m_activeFd);
+}
+
+void RaftWal::Append(const raftRpcProto::LogEntry &entry)
+{
+    Append(std::vector<raftRpcProto::LogEntry>{entry});
+}
+
+void RaftWal::Append(const std::vector<raftRpcProto::LogEntry> &entries)
+{
+    // 同一个段内的记录先编码到buf，一次write写入
+    std::string buf;
+    for (const auto &entry : entries)
+    {
+        int lastIndex = LastIndex();
+        myAssert(lastIndex == -1 || entry.logindex() == lastIndex + 1,
+                 format("[func-RaftWal::Append] entry.logIndex{%d} != lastIndex{%d} + 1", entry.logindex(), lastIndex));
+
+        if (!m_segments.back().offsets.empty() &&
+            m_segments.back().size + static_cast<long long>(buf.size()) >= WAL_SEGMENT_MAX_BYTES)
+        {
+            writeActive(buf);
+            buf.clear();
+            rollSegment();
+        }
+
+        Segment &active = m_segments.back();
+        active.offsets.push_back(active.size + buf.size());
+        if (active.firstIndex == -1)
+            active.firstIndex = entry.logindex();
+        active.lastIndex = entry.logindex();
+        encodeRecord(entry, &buf);
+    }
+    writeActive(buf);
+}
+
+void RaftWal::TruncateSuffix(int fromIndex)
+{
+    // 整段都在fromIndex之后的段直接删除，至少保留一个段作为活跃段
+    while (m_segments.size() > 1 &&
+           (m_segments.back().firstIndex == -1 || m_segments.back().firstIndex >= fromIndex))
+    {
+        ::close(m_activeFd);
+        m_activeFd = -1;
+        removeSegment(m_segments.back());
+        m_segments.pop_back();
+    }
+    // 删除过段时重新打开活跃段，openActive会fsync目录
+    if (m_activeFd == -1)
+        openActive();
+
+    Segment &active = m_segments.back();
+    if (active.lastIndex == -1 || active.lastIndex < fromIndex)
+        return;
+
+    // 剩下的部分落在活跃段内，按记录偏移截断文件
+    size_t keep = fromIndex <= active.firstIndex ? 0 : fromIndex - active.firstIndex;
+    long long newSize = active.offsets[keep];
+    myAssert(::ftruncate(m_activeFd, newSize) == 0,
+             format("[func-RaftWal::TruncateSuffix] ftruncate %s failed, errno:%d", active.path, errno));
+    active.offsets.resize(keep);
+    active.size = newSize;
+    if (keep == 0)
+    {
+        active.firstIndex = -1;
+        active.lastIndex = -1;
+    }
+    else
+    {
+        active.lastIndex = fromIndex - 1;
+    }
+}
+
+void RaftWal::CompactTo(int lastIncludedIndex)
+{
+    bool removed = false;
+    while (!m_segments.empty())
+    {
+        Segment &seg = m_segments.front();
+        if (seg.lastIndex == -1 || seg.lastIndex > lastIncludedIndex)
+            break;
+
+        if (m_segments.size() == 1)
+        {
+            // 活跃段也被快照完全覆盖，清空后继续作为活跃段使用
+            myAssert(::ftruncate(m_activeFd, 0) == 0,
+                     format("[func-RaftWal::CompactTo] ftruncate %s failed, errno:%d", seg.path, errno));
+            seg.offsets.clear();
+            seg.size = 0;
+            seg.firstIndex = -1;
+            seg.lastIndex = -1;
+            break;
+        }
+        removeSegment(seg);
+        m_segments.erase(m_segments.begin());
+        removed = true;
+    }
+    if (removed)
+        syncDir();
+}
+
+void RaftWal::Reset()
+{
+    uint64_t nextSeq = m_segments.empty() ? 0 : m_segments.back().seq + 1;
+    if (m_activeFd != -1)
+    {
+        ::close(m_activeFd);
+        m_activeFd = -1;
+    }
+    for (const auto &seg : m_segments)
+        removeSegment(seg);
+    m_segments.clear();
+
+    m_segments.push_back(Segment{nextSeq, segmentPath(nextSeq), -1, -1, {}, 0});
+    openActive();
+}
+
+std::vector<raftRpcProto::LogEntry> RaftWal::ReadAll()
+{
+    std::vector<raftRpcProto::LogEntry> entries;
+    for (const auto &seg : m_segments)
+    {
+        Segment tmp{seg.seq, seg.path, -1, -1, {}, 0};
+        scanSegment(&tmp, &entries);
+    }
+    return entries;
+}
+
+int RaftWal::FirstIndex() const
+{
+    for (const auto &seg : m_segments)
+    {
+        if (seg.firstIndex != -1)
+            return seg.firstIndex;
+    }
+    return -1;
+}
+
+int RaftWal::LastIndex() const
+{
+    for (auto it = m_segments.rbegin(); it != m_segments.rend(); ++it)
+    {
+        if (it->lastIndex != -1)
+            return it->lastIndex;
+    }
+    return -1;
+}
+
+long long RaftWal::SizeBytes() const
+{
+    long long total = 0;
+    for (const auto &seg : m_segments)
+        total += seg.size;
+    return total;
+}
+
+long long RaftWal::RecordSize(const raftRpcProto::LogEntry &entry)
+{
+    return kRecordHeaderSize + entry.command().size();
+}
+
+int RaftWal::DupActiveFd() const
+{
+    int fd = ::dup(m_activeFd);
+    myAssert(fd != -1, format("[func-RaftWal::DupActiveFd] dup failed, errno:%d", errno));
+    return fd;
+}
+
+void RaftWal::recover()
+{
+    if (::mkdir(m_dir.c_str(), 0755) != 0 && errno != EEXIST)
+        myAssert(false, format("[func-RaftWal::recover] mkdir %s failed, errno:%d", m_dir, errno));
+
+    std::vector<uint64_t> seqs;
+    DIR *dir = ::opendir(m_dir.c_str());
+    myAssert(dir != nullptr, format("[func-RaftWal::recover] opendir %s failed, errno:%d", m_dir, errno));
+    while (dirent *ent = ::readdir(dir))
+    {
+        std::string name = ent->d_name;
+        size_t suffixLen = strlen(kSegmentSuffix);
+        if (name.size() <= suffixLen || name.compare(name.size() - suffixLen, suffixLen, kSegmentSuffix) != 0)
+            continue;
+        seqs.push_back(std::strtoull(name.c_str(), nullptr, 10));
+    }
+    ::closedir(dir);
+    std::sort(seqs.begin(), seqs.end());
+
+    for (size_t i = 0; i < seqs.size(); ++i)
+    {
+        Segment seg{seqs[i], segmentPath(seqs[i]), -1, -1, {}, 0};
+        bool intact = scanSegment(&seg);
+        // 段与段之间的日志也必须连续
+        int lastIndex = LastIndex();
+        if (lastIndex != -1 && seg.firstIndex != -1 && seg.firstIndex != lastIndex + 1)
+        {
+            seg = Segment{seqs[i], segmentPath(seqs[i]), -1, -1, {}, 0};
+            intact = false;
+        }
+        m_segments.push_back(seg);
+        if (intact)
+            continue;
+
+        // 崩溃时写了一半的记录：截掉坏的尾部，之后的段全部丢弃
+        DPrintf("[func-RaftWal::recover] segment %s has a torn tail, truncate to %lld", seg.path.c_str(), seg.size);
+        myAssert(::truncate(seg.path.c_str(), seg.size) == 0,
+                 format("[func-RaftWal::recover] truncate %s failed, errno:%d", seg.path, errno));
+        for (size_t j = i + 1; j < seqs.size(); ++j)
+            ::unlink(segmentPath(seqs[j]).c_str());
+        break;
+    }
+
+    if (m_segments.empty())
+        m_segments.push_back(Segment{0, segmentPath(0), -1, -1, {}, 0});
+    openActive();
+}
+
+bool RaftWal::scanSegment(Segment *seg, std::vector<raftRpcProto::LogEntry> *entries) const
+{
+    std::ifstream ifs(seg->path, std::ios::in | std::ios::binary);
+    if (!ifs.good())
+        return false;
+    std::string data((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+    size_t pos = 0;
+    while (pos + kRecordHeaderSize <= data.size())
+    {
+        uint32_t lenAndType;
+        uint32_t sum;
+        int32_t logIndex;
+        int32_t logTerm;
+        memcpy(&lenAndType, data.data() + pos, 4);
+        memcpy(&sum, data.data() + pos + 4, 4);
+        memcpy(&logIndex, data.data() + pos + 8, 4);
+        memcpy(&logTerm, data.data() + pos + 12, 4);
+        uint32_t commandLen = lenAndType & kCommandLenMask;
+
+        if (pos + kRecordHeaderSize + commandLen > data.size())
+            break;
+        if (checksum(data.data() + pos + kChecksumOffset, kRecordHeaderSize - kChecksumOffset + commandLen) != sum)
+            break;
+        if (seg->lastIndex != -1 && logIndex != seg->lastIndex + 1)
+            break;
+
+        seg->offsets.push_back(pos);
+        if (seg->firstIndex == -1)
+            seg->firstIndex = logIndex;
+        seg->lastIndex = logIndex;
+        if (entries != nullptr)
+        {
+            raftRpcProto::LogEntry entry;
+            entry.set_logindex(logIndex);
+            entry.set_logterm(logTerm);
+            entry.set_type(static_cast<raftRpcProto::EntryType>(lenAndType >> kEntryTypeShift));
+            entry.set_command(data.data() + pos + kRecordHeaderSize, commandLen);
+            entries->push_back(std::move(entry));
+        }
+        pos += kRecordHeaderSize + commandLen;
+    }
+    seg->size = pos;
+    return pos == data.size();
+}
+
+void RaftWal::openActive()
+{
+    const Segment &active = m_segments.back();
+    m_activeFd = ::open(active.path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    myAssert(m_activeFd != -1, format("[func-RaftWal::openActive] open %s failed, errno:%d", active.path, errno));
+    syncDir();
+}
+
+void RaftWal::rollSegment()
+{
+    // 之后的fdatasync只针对新的活跃段，旧段要在关闭前落盘
+    myAssert(::fdatasync(m_activeFd) == 0,
+             format("[func-RaftWal::rollSegment] fdatasync %s failed, errno:%d", m_segments.back().path, errno));
+    ::close(m_activeFd);
+    m_activeFd = -1;
+    uint64_t seq = m_segments.back().seq + 1;
+    m_segments.push_back(Segment{seq, segmentPath(seq), -1, -1, {}, 0});
+    openActive();
+}
+
+void RaftWal::removeSegment(const Segment &seg)
+{
+    if (::unlink(seg.path.c_str()) != 0 && errno != ENOENT)
+        DPrintf("[func-RaftWal::removeSegment] unlink %s failed, errno:%d", seg.path.c_str(), errno);
+}
+
+void RaftWal::syncDir()
+{
+    int dirFd = ::open(m_dir.c_str(), O_RDONLY | O_DIRECTORY);
+    myAssert(dirFd != -1, format("[func-RaftWal::syncDir] open %s failed, errno:%d", m_dir, errno));
+    myAssert(::fsync(dirFd) == 0, format("[func-RaftWal::syncDir] fsync %s failed, errno:%d", m_dir, errno));
+    ::close(dirFd);
+}
+
+std::string RaftWal::segmentPath(uint64_t seq) const
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llu", static_cast<unsigned long long>(seq));
+    return m_dir + "/" + name + kSegmentSuffix;
+}
+
+void RaftWal::writeActive(const std::string &buf)
+{
+    size_t written = 0;
+    while (written < buf.size())
+    {
+        ssize_t n = ::write(m_activeFd, buf.data() + written, buf.size() - written);
+        if (n == -1 && errno == EINTR)
+            continue;
+        myAssert(n > 0, format("[func-RaftWal::writeActive] write %s failed, errno:%d", m_segments.back().path, errno));
+        written += n;
+    }
+    m_segments.back().size += buf.size();
+}
+
+void RaftWal::encodeRecord(const raftRpcProto::LogEntry &entry, std::string *buf)
+{
+    const std::string &command = entry.command();
+    uint32_t commandLen = command.size();
+    myAssert(commandLen <= kCommandLenMask,
+             format("[func-RaftWal::encodeRecord] command of logIndex{%d} too large: %d", entry.logindex(), commandLen));
+    uint32_t lenAndType = commandLen | (static_cast<uint32_t>(entry.type()) << kEntryTypeShift);
+    int32_t logIndex = entry.logindex();
+    int32_t logTerm = entry.logterm();
+
+    size_t start = buf->size();
+    buf->resize(start + kRecordHeaderSize);
+    char *header = &(*buf)[start];
+    memcpy(header, &lenAndType, 4);
+    memcpy(header + 8, &logIndex, 4);
+    memcpy(header + 12, &logTerm, 4);
+    buf->append(command);
+
+    uint32_t sum = checksum(buf->data() + start + kChecksumOffset, kRecordHeaderSize - kChecksumOffset + commandLen);
+    memcpy(&(*buf)[start + 4], &sum, 4);
+}
+
+uint32_t RaftWal::checksum(const char *data, size_t len)
+{
+    // FNV-1a，只用来发现写了一半的记录，不需要密码学强度
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; ++i)
+    {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
@@ -0,0 +1,195 @@
+#include "include/snapshotCodec.h"
+#include <climits>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#if __has_include(<lz4.h>)
+#include <lz4.h>
+#define SNAPSHOT_CODEC_LZ4
+#endif
+#if __has_include(<zstd.h>)
+#include <zstd.h>
+#define SNAPSHOT_CODEC_ZSTD
+#endif
+#include "../common/include/util.h"
+
+namespace {
+
+#ifdef SNAPSHOT_CODEC_LZ4
+size_t lz4Bound(size_t rawSize)
+{
+    return LZ4_compressBound(static_cast<int>(rawSize));
+}
+
+size_t lz4Compress(const char *src, size_t srcSize, char *dst, size_t dstCapacity)
+{
+    // LZ4的接口是int长度，超过2GB的快照不压缩
+    if (srcSize > static_cast<size_t>(LZ4_MAX_INPUT_SIZE))
+        return 0;
+    int n = LZ4_compress_default(src, dst, static_cast<int>(srcSize), static_cast<int>(dstCapacity));
+    return n > 0 ? n : 0;
+}
+
+bool lz4Decompress(const char *src, size_t srcSize, char *dst, size_t rawSize)
+{
+    if (srcSize > INT_MAX || rawSize > INT_MAX)
+        return false;
+    int n = LZ4_decompress_safe(src, dst, static_cast<int>(srcSize), static_cast<int>(rawSize));
+    return n >= 0 && static_cast<size_t>(n) == rawSize;
+}
+#endif
+
+#ifdef SNAPSHOT_CODEC_ZSTD
+// zstd的默认级别，压缩率和速度比较均衡
+const int kZstdLevel = 3;
+
+size_t zstdBound(size_t rawSize)
+{
+    return ZSTD_compressBound(rawSize);
+}
+
+size_t zstdCompress(const char *src, size_t srcSize, char *dst, size_t dstCapacity)
+{
+    size_t n = ZSTD_compress(dst, dstCapacity, src, srcSize, kZstdLevel);
+    return ZSTD_isError(n) ? 0 : n;
+}
+
+bool zstdDecompress(const char *src, size_t srcSize, char *dst, size_t rawSize)
+{
+    size_t n = ZSTD_decompress(dst, rawSize, src, srcSize);
+    return !ZSTD_isError(n) && n == rawSize;
+}
+#endif
+
+template <class T>
+char *put(char *p, T value)
+{
+    memcpy(p, &value, sizeof(T));
+    return p + sizeof(T);
+}
+
+template <class T>
+const char *get(const char *p, T *value)
+{
+    memcpy(value, p, sizeof(T));
+    return p + sizeof(T);
+}
+
+} // namespace
+
+const SnapshotCodec::Codec *SnapshotCodec::findCodec(int compression)
+{
+    switch (compression)
+    {
+#ifdef SNAPSHOT_CODEC_LZ4
+    case SnapshotCompressLz4:
+    {
+        static const Codec codec = {lz4Bound, lz4Compress, lz4Decompress};
+        return &codec;
+    }
+#endif
+#ifdef SNAPSHOT_CODEC_ZSTD
+    case SnapshotCompressZstd:
+    {
+        static const Codec codec = {zstdBound, zstdCompress, zstdDecompress};
+        return &codec;
+    }
+#endif
+    default:
+        return nullptr;
+    }
+}
+
+bool SnapshotCodec::Supported(int compression)
+{
+    return compression == SnapshotCompressNone || findCodec(compression) != nullptr;
+}
+
+void SnapshotCodec::WarnIfUnsupported(int compression)
+{
+    if (Supported(compression))
+        return;
+    static std::once_flag warned;
+    std::call_once(warned,
+                   [compression]()
+                   {
+                       const char *name = compression == SnapshotCompressLz4    ? "LZ4（lz4.h）"
+                                          : compression == SnapshotCompressZstd ? "zstd（zstd.h）"
+                                                                                : "未知算法";
+                       std::cerr << "[SnapshotCodec] SNAPSHOT_COMPRESSION=" << compression << "选择了" << name
+                                 << "，但是编译时没有找到它，快照将不压缩保存和发送。"
+                                 << "安装对应的开发包后重新编译，或者把SNAPSHOT_COMPRESSION改为0" << std::endl;
+                   });
+}
+
+std::string SnapshotCodec::Encode(const std::string &raw, int compression)
+{
+    const Codec *codec = findCodec(compression);
+    if (codec == nullptr)
+        compression = SnapshotCompressNone;
+
+    std::string buf;
+    size_t payloadSize = raw.size();
+    if (codec != nullptr)
+    {
+        buf.resize(kHeaderSize + codec->bound(raw.size()));
+        payloadSize = codec->compress(raw.data(), raw.size(), &buf[kHeaderSize], buf.size() - kHeaderSize);
+        // 压缩失败或者没有变小，按不压缩保存
+        if (payloadSize == 0 || payloadSize >= raw.size())
+        {
+            compression = SnapshotCompressNone;
+            payloadSize = raw.size();
+        }
+    }
+    buf.resize(kHeaderSize + payloadSize);
+    if (compression == SnapshotCompressNone)
+        memcpy(&buf[kHeaderSize], raw.data(), raw.size());
+
+    char *p = &buf[0];
+    p = put(p, kMagic);
+    p = put(p, static_cast<uint8_t>(compression));
+    p = put(p, static_cast<uint8_t>(0));
+    p = put(p, static_cast<uint16_t>(0));
+    p = put(p, static_cast<uint64_t>(raw.size()));
+    return buf;
+}
+
+bool SnapshotCodec::Decode(const std::string &data, std::string *raw)
+{
+    uint32_t magic = 0;
+    if (data.size() >= kHeaderSize)
+        get(data.data(), &magic);
+    if (magic != kMagic)
+    {
+        // 旧格式，没有压缩
+        *raw = data;
+        return true;
+    }
+
+    const char *p = data.data() + sizeof(uint32_t);
+    uint8_t compression;
+    uint8_t reserved8;
+    uint16_t reserved16;
+    uint64_t rawSize;
+    p = get(p, &compression);
+    p = get(p, &reserved8);
+    p = get(p, &reserved16);
+    p = get(p, &rawSize);
+    size_t payloadSize = data.size() - kHeaderSize;
+
+    if (compression == SnapshotCompressNone)
+    {
+        if (payloadSize != rawSize)
+            return false;
+        raw->assign(p, payloadSize);
+        return true;
+    }
+    const Codec *codec = findCodec(compression);
+    if (codec == nullptr)
+    {
+        DPrintf("[func-SnapshotCodec::Decode] 快照使用的压缩算法{%d}没有编译进来", compression);
+        return false;
+    }
+    raw->resize(rawSize);
+    return codec->decompress(p, payloadSize, rawSize == 0 ? nullptr : &(*raw)[0], rawSize);
+}
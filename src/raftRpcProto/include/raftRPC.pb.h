@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,14 +23,13 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/service.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
@@ -44,58 +43,141 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_raftRPC_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[7]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_raftRPC_2eproto;
 namespace raftRpcProto {
 class AppendEntriesArgs;
-class AppendEntriesArgsDefaultTypeInternal;
+struct AppendEntriesArgsDefaultTypeInternal;
 extern AppendEntriesArgsDefaultTypeInternal _AppendEntriesArgs_default_instance_;
 class AppendEntriesReply;
-class AppendEntriesReplyDefaultTypeInternal;
+struct AppendEntriesReplyDefaultTypeInternal;
 extern AppendEntriesReplyDefaultTypeInternal _AppendEntriesReply_default_instance_;
+class BatchAppendEntriesArgs;
+struct BatchAppendEntriesArgsDefaultTypeInternal;
+extern BatchAppendEntriesArgsDefaultTypeInternal _BatchAppendEntriesArgs_default_instance_;
+class BatchAppendEntriesReply;
+struct BatchAppendEntriesReplyDefaultTypeInternal;
+extern BatchAppendEntriesReplyDefaultTypeInternal _BatchAppendEntriesReply_default_instance_;
+class ClusterConfig;
+struct ClusterConfigDefaultTypeInternal;
+extern ClusterConfigDefaultTypeInternal _ClusterConfig_default_instance_;
+class ConfChange;
+struct ConfChangeDefaultTypeInternal;
+extern ConfChangeDefaultTypeInternal _ConfChange_default_instance_;
 class InstallSnapshotRequest;
-class InstallSnapshotRequestDefaultTypeInternal;
+struct InstallSnapshotRequestDefaultTypeInternal;
 extern InstallSnapshotRequestDefaultTypeInternal _InstallSnapshotRequest_default_instance_;
 class InstallSnapshotResponse;
-class InstallSnapshotResponseDefaultTypeInternal;
+struct InstallSnapshotResponseDefaultTypeInternal;
 extern InstallSnapshotResponseDefaultTypeInternal _InstallSnapshotResponse_default_instance_;
 class LogEntry;
-class LogEntryDefaultTypeInternal;
+struct LogEntryDefaultTypeInternal;
 extern LogEntryDefaultTypeInternal _LogEntry_default_instance_;
+class PeerAddr;
+struct PeerAddrDefaultTypeInternal;
+extern PeerAddrDefaultTypeInternal _PeerAddr_default_instance_;
+class ReadIndexArgs;
+struct ReadIndexArgsDefaultTypeInternal;
+extern ReadIndexArgsDefaultTypeInternal _ReadIndexArgs_default_instance_;
+class ReadIndexReply;
+struct ReadIndexReplyDefaultTypeInternal;
+extern ReadIndexReplyDefaultTypeInternal _ReadIndexReply_default_instance_;
 class RequestVoteArgs;
-class RequestVoteArgsDefaultTypeInternal;
+struct RequestVoteArgsDefaultTypeInternal;
 extern RequestVoteArgsDefaultTypeInternal _RequestVoteArgs_default_instance_;
 class RequestVoteReply;
-class RequestVoteReplyDefaultTypeInternal;
+struct RequestVoteReplyDefaultTypeInternal;
 extern RequestVoteReplyDefaultTypeInternal _RequestVoteReply_default_instance_;
+class TimeoutNowArgs;
+struct TimeoutNowArgsDefaultTypeInternal;
+extern TimeoutNowArgsDefaultTypeInternal _TimeoutNowArgs_default_instance_;
+class TimeoutNowReply;
+struct TimeoutNowReplyDefaultTypeInternal;
+extern TimeoutNowReplyDefaultTypeInternal _TimeoutNowReply_default_instance_;
 }  // namespace raftRpcProto
 PROTOBUF_NAMESPACE_OPEN
 template<> ::raftRpcProto::AppendEntriesArgs* Arena::CreateMaybeMessage<::raftRpcProto::AppendEntriesArgs>(Arena*);
 template<> ::raftRpcProto::AppendEntriesReply* Arena::CreateMaybeMessage<::raftRpcProto::AppendEntriesReply>(Arena*);
+template<> ::raftRpcProto::BatchAppendEntriesArgs* Arena::CreateMaybeMessage<::raftRpcProto::BatchAppendEntriesArgs>(Arena*);
+template<> ::raftRpcProto::BatchAppendEntriesReply* Arena::CreateMaybeMessage<::raftRpcProto::BatchAppendEntriesReply>(Arena*);
+template<> ::raftRpcProto::ClusterConfig* Arena::CreateMaybeMessage<::raftRpcProto::ClusterConfig>(Arena*);
+template<> ::raftRpcProto::ConfChange* Arena::CreateMaybeMessage<::raftRpcProto::ConfChange>(Arena*);
 template<> ::raftRpcProto::InstallSnapshotRequest* Arena::CreateMaybeMessage<::raftRpcProto::InstallSnapshotRequest>(Arena*);
 template<> ::raftRpcProto::InstallSnapshotResponse* Arena::CreateMaybeMessage<::raftRpcProto::InstallSnapshotResponse>(Arena*);
 template<> ::raftRpcProto::LogEntry* Arena::CreateMaybeMessage<::raftRpcProto::LogEntry>(Arena*);
+template<> ::raftRpcProto::PeerAddr* Arena::CreateMaybeMessage<::raftRpcProto::PeerAddr>(Arena*);
+template<> ::raftRpcProto::ReadIndexArgs* Arena::CreateMaybeMessage<::raftRpcProto::ReadIndexArgs>(Arena*);
+template<> ::raftRpcProto::ReadIndexReply* Arena::CreateMaybeMessage<::raftRpcProto::ReadIndexReply>(Arena*);
 template<> ::raftRpcProto::RequestVoteArgs* Arena::CreateMaybeMessage<::raftRpcProto::RequestVoteArgs>(Arena*);
 template<> ::raftRpcProto::RequestVoteReply* Arena::CreateMaybeMessage<::raftRpcProto::RequestVoteReply>(Arena*);
+template<> ::raftRpcProto::TimeoutNowArgs* Arena::CreateMaybeMessage<::raftRpcProto::TimeoutNowArgs>(Arena*);
+template<> ::raftRpcProto::TimeoutNowReply* Arena::CreateMaybeMessage<::raftRpcProto::TimeoutNowReply>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace raftRpcProto {
 
+enum EntryType : int {
+  EntryNormal = 0,
+  EntryConfChange = 1,
+  EntryType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  EntryType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool EntryType_IsValid(int value);
+constexpr EntryType EntryType_MIN = EntryNormal;
+constexpr EntryType EntryType_MAX = EntryConfChange;
+constexpr int EntryType_ARRAYSIZE = EntryType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EntryType_descriptor();
+template<typename T>
+inline const std::string& EntryType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, EntryType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function EntryType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    EntryType_descriptor(), enum_t_value);
+}
+inline bool EntryType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, EntryType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<EntryType>(
+    EntryType_descriptor(), name, value);
+}
+enum ConfChangeType : int {
+  ConfAddLearner = 0,
+  ConfPromoteLearner = 1,
+  ConfRemoveLearner = 2,
+  ConfEnterJoint = 3,
+  ConfLeaveJoint = 4,
+  ConfAddWitness = 5,
+  ConfChangeType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ConfChangeType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool ConfChangeType_IsValid(int value);
+constexpr ConfChangeType ConfChangeType_MIN = ConfAddLearner;
+constexpr ConfChangeType ConfChangeType_MAX = ConfAddWitness;
+constexpr int ConfChangeType_ARRAYSIZE = ConfChangeType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ConfChangeType_descriptor();
+template<typename T>
+inline const std::string& ConfChangeType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ConfChangeType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ConfChangeType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ConfChangeType_descriptor(), enum_t_value);
+}
+inline bool ConfChangeType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ConfChangeType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ConfChangeType>(
+    ConfChangeType_descriptor(), name, value);
+}
 // ===================================================================
 
-class LogEntry PROTOBUF_FINAL :
+class LogEntry final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.LogEntry) */ {
  public:
-  inline LogEntry() : LogEntry(nullptr) {};
-  virtual ~LogEntry();
+  inline LogEntry() : LogEntry(nullptr) {}
+  ~LogEntry() override;
+  explicit PROTOBUF_CONSTEXPR LogEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LogEntry(const LogEntry& from);
   LogEntry(LogEntry&& from) noexcept
@@ -108,8 +190,13 @@ class LogEntry PROTOBUF_FINAL :
     return *this;
   }
   inline LogEntry& operator=(LogEntry&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -120,14 +207,14 @@ class LogEntry PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LogEntry& default_instance() {
+    return *internal_default_instance();
   }
-  static const LogEntry& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const LogEntry* internal_default_instance() {
     return reinterpret_cast<const LogEntry*>(
                &_LogEntry_default_instance_);
@@ -140,7 +227,12 @@ class LogEntry PROTOBUF_FINAL :
   }
   inline void Swap(LogEntry* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -148,56 +240,53 @@ class LogEntry PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(LogEntry* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline LogEntry* New() const final {
-    return CreateMaybeMessage<LogEntry>(nullptr);
-  }
-
-  LogEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  LogEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LogEntry>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LogEntry& from);
-  void MergeFrom(const LogEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LogEntry& from) {
+    LogEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LogEntry* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "raftRpcProto.LogEntry";
   }
   protected:
-  explicit LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -207,48 +296,47 @@ class LogEntry PROTOBUF_FINAL :
     kCommandFieldNumber = 1,
     kLogTermFieldNumber = 2,
     kLogIndexFieldNumber = 3,
+    kTypeFieldNumber = 4,
   };
   // bytes Command = 1;
   void clear_command();
   const std::string& command() const;
-  void set_command(const std::string& value);
-  void set_command(std::string&& value);
-  void set_command(const char* value);
-  void set_command(const void* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_command(ArgT0&& arg0, ArgT... args);
   std::string* mutable_command();
-  std::string* release_command();
+  PROTOBUF_NODISCARD std::string* release_command();
   void set_allocated_command(std::string* command);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_command();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_command(
-      std::string* command);
   private:
   const std::string& _internal_command() const;
-  void _internal_set_command(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_command(const std::string& value);
   std::string* _internal_mutable_command();
   public:
 
   // int32 LogTerm = 2;
   void clear_logterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 logterm() const;
-  void set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t logterm() const;
+  void set_logterm(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_logterm() const;
-  void _internal_set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_logterm() const;
+  void _internal_set_logterm(int32_t value);
   public:
 
   // int32 LogIndex = 3;
   void clear_logindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 logindex() const;
-  void set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t logindex() const;
+  void set_logindex(int32_t value);
+  private:
+  int32_t _internal_logindex() const;
+  void _internal_set_logindex(int32_t value);
+  public:
+
+  // .raftRpcProto.EntryType Type = 4;
+  void clear_type();
+  ::raftRpcProto::EntryType type() const;
+  void set_type(::raftRpcProto::EntryType value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_logindex() const;
-  void _internal_set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  ::raftRpcProto::EntryType _internal_type() const;
+  void _internal_set_type(::raftRpcProto::EntryType value);
   public:
 
   // @@protoc_insertion_point(class_scope:raftRpcProto.LogEntry)
@@ -258,33 +346,43 @@ class LogEntry PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
-  ::PROTOBUF_NAMESPACE_ID::int32 logterm_;
-  ::PROTOBUF_NAMESPACE_ID::int32 logindex_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
+    int32_t logterm_;
+    int32_t logindex_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AppendEntriesArgs PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.AppendEntriesArgs) */ {
+class PeerAddr final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.PeerAddr) */ {
  public:
-  inline AppendEntriesArgs() : AppendEntriesArgs(nullptr) {};
-  virtual ~AppendEntriesArgs();
+  inline PeerAddr() : PeerAddr(nullptr) {}
+  ~PeerAddr() override;
+  explicit PROTOBUF_CONSTEXPR PeerAddr(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AppendEntriesArgs(const AppendEntriesArgs& from);
-  AppendEntriesArgs(AppendEntriesArgs&& from) noexcept
-    : AppendEntriesArgs() {
+  PeerAddr(const PeerAddr& from);
+  PeerAddr(PeerAddr&& from) noexcept
+    : PeerAddr() {
     *this = ::std::move(from);
   }
 
-  inline AppendEntriesArgs& operator=(const AppendEntriesArgs& from) {
+  inline PeerAddr& operator=(const PeerAddr& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AppendEntriesArgs& operator=(AppendEntriesArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline PeerAddr& operator=(PeerAddr&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -295,197 +393,171 @@ class AppendEntriesArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const AppendEntriesArgs& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const AppendEntriesArgs* internal_default_instance() {
-    return reinterpret_cast<const AppendEntriesArgs*>(
-               &_AppendEntriesArgs_default_instance_);
+  static const PeerAddr& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PeerAddr* internal_default_instance() {
+    return reinterpret_cast<const PeerAddr*>(
+               &_PeerAddr_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     1;
 
-  friend void swap(AppendEntriesArgs& a, AppendEntriesArgs& b) {
+  friend void swap(PeerAddr& a, PeerAddr& b) {
     a.Swap(&b);
   }
-  inline void Swap(AppendEntriesArgs* other) {
+  inline void Swap(PeerAddr* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AppendEntriesArgs* other) {
+  void UnsafeArenaSwap(PeerAddr* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AppendEntriesArgs* New() const final {
-    return CreateMaybeMessage<AppendEntriesArgs>(nullptr);
+  PeerAddr* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PeerAddr>(arena);
   }
-
-  AppendEntriesArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<AppendEntriesArgs>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PeerAddr& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PeerAddr& from) {
+    PeerAddr::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const AppendEntriesArgs& from);
-  void MergeFrom(const AppendEntriesArgs& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(AppendEntriesArgs* other);
+  void InternalSwap(PeerAddr* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "raftRpcProto.AppendEntriesArgs";
+    return "raftRpcProto.PeerAddr";
   }
   protected:
-  explicit AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PeerAddr(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kEntriesFieldNumber = 5,
-    kTermFieldNumber = 1,
-    kLeaderIdFieldNumber = 2,
-    kPrevLogIndexFieldNumber = 3,
-    kPrevLogTermFieldNumber = 4,
-    kLeaderCommitFieldNumber = 6,
+    kIpFieldNumber = 2,
+    kNodeIdFieldNumber = 1,
+    kPortFieldNumber = 3,
   };
-  // repeated .raftRpcProto.LogEntry Entries = 5;
-  int entries_size() const;
-  private:
-  int _internal_entries_size() const;
-  public:
-  void clear_entries();
-  ::raftRpcProto::LogEntry* mutable_entries(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::LogEntry >*
-      mutable_entries();
-  private:
-  const ::raftRpcProto::LogEntry& _internal_entries(int index) const;
-  ::raftRpcProto::LogEntry* _internal_add_entries();
-  public:
-  const ::raftRpcProto::LogEntry& entries(int index) const;
-  ::raftRpcProto::LogEntry* add_entries();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::LogEntry >&
-      entries() const;
-
-  // int32 Term = 1;
-  void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // int32 LeaderId = 2;
-  void clear_leaderid();
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid() const;
-  void set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_leaderid() const;
-  void _internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // int32 PrevLogIndex = 3;
-  void clear_prevlogindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogindex() const;
-  void set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // string Ip = 2;
+  void clear_ip();
+  const std::string& ip() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip();
+  PROTOBUF_NODISCARD std::string* release_ip();
+  void set_allocated_ip(std::string* ip);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_prevlogindex() const;
-  void _internal_set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const std::string& _internal_ip() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip(const std::string& value);
+  std::string* _internal_mutable_ip();
   public:
 
-  // int32 PrevLogTerm = 4;
-  void clear_prevlogterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogterm() const;
-  void set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // int32 NodeId = 1;
+  void clear_nodeid();
+  int32_t nodeid() const;
+  void set_nodeid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_prevlogterm() const;
-  void _internal_set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_nodeid() const;
+  void _internal_set_nodeid(int32_t value);
   public:
 
-  // int32 LeaderCommit = 6;
-  void clear_leadercommit();
-  ::PROTOBUF_NAMESPACE_ID::int32 leadercommit() const;
-  void set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // int32 Port = 3;
+  void clear_port();
+  int32_t port() const;
+  void set_port(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_leadercommit() const;
-  void _internal_set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_port() const;
+  void _internal_set_port(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:raftRpcProto.AppendEntriesArgs)
+  // @@protoc_insertion_point(class_scope:raftRpcProto.PeerAddr)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::LogEntry > entries_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 prevlogterm_;
-  ::PROTOBUF_NAMESPACE_ID::int32 leadercommit_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_;
+    int32_t nodeid_;
+    int32_t port_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AppendEntriesReply PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.AppendEntriesReply) */ {
+class ConfChange final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.ConfChange) */ {
  public:
-  inline AppendEntriesReply() : AppendEntriesReply(nullptr) {};
-  virtual ~AppendEntriesReply();
+  inline ConfChange() : ConfChange(nullptr) {}
+  ~ConfChange() override;
+  explicit PROTOBUF_CONSTEXPR ConfChange(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AppendEntriesReply(const AppendEntriesReply& from);
-  AppendEntriesReply(AppendEntriesReply&& from) noexcept
-    : AppendEntriesReply() {
+  ConfChange(const ConfChange& from);
+  ConfChange(ConfChange&& from) noexcept
+    : ConfChange() {
     *this = ::std::move(from);
   }
 
-  inline AppendEntriesReply& operator=(const AppendEntriesReply& from) {
+  inline ConfChange& operator=(const ConfChange& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AppendEntriesReply& operator=(AppendEntriesReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline ConfChange& operator=(ConfChange&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -496,166 +568,200 @@ class AppendEntriesReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const AppendEntriesReply& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const AppendEntriesReply* internal_default_instance() {
-    return reinterpret_cast<const AppendEntriesReply*>(
-               &_AppendEntriesReply_default_instance_);
+  static const ConfChange& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConfChange* internal_default_instance() {
+    return reinterpret_cast<const ConfChange*>(
+               &_ConfChange_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     2;
 
-  friend void swap(AppendEntriesReply& a, AppendEntriesReply& b) {
+  friend void swap(ConfChange& a, ConfChange& b) {
     a.Swap(&b);
   }
-  inline void Swap(AppendEntriesReply* other) {
+  inline void Swap(ConfChange* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AppendEntriesReply* other) {
+  void UnsafeArenaSwap(ConfChange* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AppendEntriesReply* New() const final {
-    return CreateMaybeMessage<AppendEntriesReply>(nullptr);
+  ConfChange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConfChange>(arena);
   }
-
-  AppendEntriesReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<AppendEntriesReply>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ConfChange& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConfChange& from) {
+    ConfChange::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const AppendEntriesReply& from);
-  void MergeFrom(const AppendEntriesReply& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(AppendEntriesReply* other);
+  void InternalSwap(ConfChange* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "raftRpcProto.AppendEntriesReply";
+    return "raftRpcProto.ConfChange";
   }
   protected:
-  explicit AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ConfChange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kTermFieldNumber = 1,
-    kSuccessFieldNumber = 2,
-    kUpdateNextIndexFieldNumber = 3,
-    kAppStateFieldNumber = 4,
+    kVotersFieldNumber = 3,
+    kAddrsFieldNumber = 4,
+    kTypeFieldNumber = 1,
+    kNodeIdFieldNumber = 2,
   };
-  // int32 Term = 1;
-  void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // repeated int32 Voters = 3;
+  int voters_size() const;
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int _internal_voters_size() const;
   public:
-
-  // bool Success = 2;
-  void clear_success();
-  bool success() const;
-  void set_success(bool value);
+  void clear_voters();
   private:
-  bool _internal_success() const;
-  void _internal_set_success(bool value);
+  int32_t _internal_voters(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_voters() const;
+  void _internal_add_voters(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_voters();
   public:
-
-  // int32 UpdateNextIndex = 3;
-  void clear_updatenextindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 updatenextindex() const;
-  void set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t voters(int index) const;
+  void set_voters(int index, int32_t value);
+  void add_voters(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      voters() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_voters();
+
+  // repeated .raftRpcProto.PeerAddr Addrs = 4;
+  int addrs_size() const;
+  private:
+  int _internal_addrs_size() const;
+  public:
+  void clear_addrs();
+  ::raftRpcProto::PeerAddr* mutable_addrs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::PeerAddr >*
+      mutable_addrs();
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_updatenextindex() const;
-  void _internal_set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::raftRpcProto::PeerAddr& _internal_addrs(int index) const;
+  ::raftRpcProto::PeerAddr* _internal_add_addrs();
+  public:
+  const ::raftRpcProto::PeerAddr& addrs(int index) const;
+  ::raftRpcProto::PeerAddr* add_addrs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::PeerAddr >&
+      addrs() const;
+
+  // .raftRpcProto.ConfChangeType Type = 1;
+  void clear_type();
+  ::raftRpcProto::ConfChangeType type() const;
+  void set_type(::raftRpcProto::ConfChangeType value);
+  private:
+  ::raftRpcProto::ConfChangeType _internal_type() const;
+  void _internal_set_type(::raftRpcProto::ConfChangeType value);
   public:
 
-  // int32 AppState = 4;
-  void clear_appstate();
-  ::PROTOBUF_NAMESPACE_ID::int32 appstate() const;
-  void set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // int32 NodeId = 2;
+  void clear_nodeid();
+  int32_t nodeid() const;
+  void set_nodeid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_appstate() const;
-  void _internal_set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_nodeid() const;
+  void _internal_set_nodeid(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:raftRpcProto.AppendEntriesReply)
+  // @@protoc_insertion_point(class_scope:raftRpcProto.ConfChange)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  bool success_;
-  ::PROTOBUF_NAMESPACE_ID::int32 updatenextindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 appstate_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > voters_;
+    mutable std::atomic<int> _voters_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::PeerAddr > addrs_;
+    int type_;
+    int32_t nodeid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RequestVoteArgs PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.RequestVoteArgs) */ {
+class ClusterConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.ClusterConfig) */ {
  public:
-  inline RequestVoteArgs() : RequestVoteArgs(nullptr) {};
-  virtual ~RequestVoteArgs();
+  inline ClusterConfig() : ClusterConfig(nullptr) {}
+  ~ClusterConfig() override;
+  explicit PROTOBUF_CONSTEXPR ClusterConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RequestVoteArgs(const RequestVoteArgs& from);
-  RequestVoteArgs(RequestVoteArgs&& from) noexcept
-    : RequestVoteArgs() {
+  ClusterConfig(const ClusterConfig& from);
+  ClusterConfig(ClusterConfig&& from) noexcept
+    : ClusterConfig() {
     *this = ::std::move(from);
   }
 
-  inline RequestVoteArgs& operator=(const RequestVoteArgs& from) {
+  inline ClusterConfig& operator=(const ClusterConfig& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RequestVoteArgs& operator=(RequestVoteArgs&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline ClusterConfig& operator=(ClusterConfig&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -666,166 +772,264 @@ class RequestVoteArgs PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const RequestVoteArgs& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const RequestVoteArgs* internal_default_instance() {
-    return reinterpret_cast<const RequestVoteArgs*>(
-               &_RequestVoteArgs_default_instance_);
+  static const ClusterConfig& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClusterConfig* internal_default_instance() {
+    return reinterpret_cast<const ClusterConfig*>(
+               &_ClusterConfig_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     3;
 
-  friend void swap(RequestVoteArgs& a, RequestVoteArgs& b) {
+  friend void swap(ClusterConfig& a, ClusterConfig& b) {
     a.Swap(&b);
   }
-  inline void Swap(RequestVoteArgs* other) {
+  inline void Swap(ClusterConfig* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(RequestVoteArgs* other) {
+  void UnsafeArenaSwap(ClusterConfig* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RequestVoteArgs* New() const final {
-    return CreateMaybeMessage<RequestVoteArgs>(nullptr);
+  ClusterConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClusterConfig>(arena);
   }
-
-  RequestVoteArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<RequestVoteArgs>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClusterConfig& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClusterConfig& from) {
+    ClusterConfig::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const RequestVoteArgs& from);
-  void MergeFrom(const RequestVoteArgs& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RequestVoteArgs* other);
+  void InternalSwap(ClusterConfig* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "raftRpcProto.RequestVoteArgs";
+    return "raftRpcProto.ClusterConfig";
   }
   protected:
-  explicit RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ClusterConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kTermFieldNumber = 1,
-    kCandidateIdFieldNumber = 2,
-    kLastLogIndexFieldNumber = 3,
-    kLastLogTermFieldNumber = 4,
+    kVotersFieldNumber = 1,
+    kLearnersFieldNumber = 2,
+    kOutgoingVotersFieldNumber = 4,
+    kAddrsFieldNumber = 5,
+    kWitnessesFieldNumber = 6,
+    kIndexFieldNumber = 3,
   };
-  // int32 Term = 1;
-  void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // repeated int32 Voters = 1;
+  int voters_size() const;
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int _internal_voters_size() const;
   public:
-
-  // int32 CandidateId = 2;
-  void clear_candidateid();
-  ::PROTOBUF_NAMESPACE_ID::int32 candidateid() const;
-  void set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  void clear_voters();
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_candidateid() const;
-  void _internal_set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_voters(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_voters() const;
+  void _internal_add_voters(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_voters();
   public:
-
-  // int32 LastLogIndex = 3;
-  void clear_lastlogindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogindex() const;
-  void set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t voters(int index) const;
+  void set_voters(int index, int32_t value);
+  void add_voters(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      voters() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_voters();
+
+  // repeated int32 Learners = 2;
+  int learners_size() const;
+  private:
+  int _internal_learners_size() const;
+  public:
+  void clear_learners();
+  private:
+  int32_t _internal_learners(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_learners() const;
+  void _internal_add_learners(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_learners();
+  public:
+  int32_t learners(int index) const;
+  void set_learners(int index, int32_t value);
+  void add_learners(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      learners() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_learners();
+
+  // repeated int32 OutgoingVoters = 4;
+  int outgoingvoters_size() const;
+  private:
+  int _internal_outgoingvoters_size() const;
+  public:
+  void clear_outgoingvoters();
+  private:
+  int32_t _internal_outgoingvoters(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_outgoingvoters() const;
+  void _internal_add_outgoingvoters(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_outgoingvoters();
+  public:
+  int32_t outgoingvoters(int index) const;
+  void set_outgoingvoters(int index, int32_t value);
+  void add_outgoingvoters(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      outgoingvoters() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_outgoingvoters();
+
+  // repeated .raftRpcProto.PeerAddr Addrs = 5;
+  int addrs_size() const;
+  private:
+  int _internal_addrs_size() const;
+  public:
+  void clear_addrs();
+  ::raftRpcProto::PeerAddr* mutable_addrs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::PeerAddr >*
+      mutable_addrs();
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastlogindex() const;
-  void _internal_set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::raftRpcProto::PeerAddr& _internal_addrs(int index) const;
+  ::raftRpcProto::PeerAddr* _internal_add_addrs();
   public:
+  const ::raftRpcProto::PeerAddr& addrs(int index) const;
+  ::raftRpcProto::PeerAddr* add_addrs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::PeerAddr >&
+      addrs() const;
 
-  // int32 LastLogTerm = 4;
-  void clear_lastlogterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogterm() const;
-  void set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // repeated int32 Witnesses = 6;
+  int witnesses_size() const;
+  private:
+  int _internal_witnesses_size() const;
+  public:
+  void clear_witnesses();
+  private:
+  int32_t _internal_witnesses(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_witnesses() const;
+  void _internal_add_witnesses(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_witnesses();
+  public:
+  int32_t witnesses(int index) const;
+  void set_witnesses(int index, int32_t value);
+  void add_witnesses(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      witnesses() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_witnesses();
+
+  // int32 Index = 3;
+  void clear_index();
+  int32_t index() const;
+  void set_index(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastlogterm() const;
-  void _internal_set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_index() const;
+  void _internal_set_index(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:raftRpcProto.RequestVoteArgs)
+  // @@protoc_insertion_point(class_scope:raftRpcProto.ClusterConfig)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  ::PROTOBUF_NAMESPACE_ID::int32 candidateid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastlogterm_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > voters_;
+    mutable std::atomic<int> _voters_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > learners_;
+    mutable std::atomic<int> _learners_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > outgoingvoters_;
+    mutable std::atomic<int> _outgoingvoters_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::PeerAddr > addrs_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > witnesses_;
+    mutable std::atomic<int> _witnesses_cached_byte_size_;
+    int32_t index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RequestVoteReply PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.RequestVoteReply) */ {
+class AppendEntriesArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.AppendEntriesArgs) */ {
  public:
-  inline RequestVoteReply() : RequestVoteReply(nullptr) {};
-  virtual ~RequestVoteReply();
+  inline AppendEntriesArgs() : AppendEntriesArgs(nullptr) {}
+  ~AppendEntriesArgs() override;
+  explicit PROTOBUF_CONSTEXPR AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RequestVoteReply(const RequestVoteReply& from);
-  RequestVoteReply(RequestVoteReply&& from) noexcept
-    : RequestVoteReply() {
+  AppendEntriesArgs(const AppendEntriesArgs& from);
+  AppendEntriesArgs(AppendEntriesArgs&& from) noexcept
+    : AppendEntriesArgs() {
     *this = ::std::move(from);
   }
 
-  inline RequestVoteReply& operator=(const RequestVoteReply& from) {
+  inline AppendEntriesArgs& operator=(const AppendEntriesArgs& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RequestVoteReply& operator=(RequestVoteReply&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline AppendEntriesArgs& operator=(AppendEntriesArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -836,155 +1040,219 @@ class RequestVoteReply PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const RequestVoteReply& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const RequestVoteReply* internal_default_instance() {
-    return reinterpret_cast<const RequestVoteReply*>(
-               &_RequestVoteReply_default_instance_);
+  static const AppendEntriesArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AppendEntriesArgs* internal_default_instance() {
+    return reinterpret_cast<const AppendEntriesArgs*>(
+               &_AppendEntriesArgs_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     4;
 
-  friend void swap(RequestVoteReply& a, RequestVoteReply& b) {
+  friend void swap(AppendEntriesArgs& a, AppendEntriesArgs& b) {
     a.Swap(&b);
   }
-  inline void Swap(RequestVoteReply* other) {
+  inline void Swap(AppendEntriesArgs* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(RequestVoteReply* other) {
+  void UnsafeArenaSwap(AppendEntriesArgs* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RequestVoteReply* New() const final {
-    return CreateMaybeMessage<RequestVoteReply>(nullptr);
+  AppendEntriesArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AppendEntriesArgs>(arena);
   }
-
-  RequestVoteReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<RequestVoteReply>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AppendEntriesArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AppendEntriesArgs& from) {
+    AppendEntriesArgs::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const RequestVoteReply& from);
-  void MergeFrom(const RequestVoteReply& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RequestVoteReply* other);
+  void InternalSwap(AppendEntriesArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "raftRpcProto.RequestVoteReply";
+    return "raftRpcProto.AppendEntriesArgs";
   }
   protected:
-  explicit RequestVoteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
+    kEntriesFieldNumber = 5,
     kTermFieldNumber = 1,
-    kVoteGrantedFieldNumber = 2,
-    kVoteStateFieldNumber = 3,
-  };
-  // int32 Term = 1;
-  void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+    kLeaderIdFieldNumber = 2,
+    kPrevLogIndexFieldNumber = 3,
+    kPrevLogTermFieldNumber = 4,
+    kLeaderCommitFieldNumber = 6,
+    kGroupIdFieldNumber = 7,
+  };
+  // repeated .raftRpcProto.LogEntry Entries = 5;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::raftRpcProto::LogEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::LogEntry >*
+      mutable_entries();
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::raftRpcProto::LogEntry& _internal_entries(int index) const;
+  ::raftRpcProto::LogEntry* _internal_add_entries();
   public:
+  const ::raftRpcProto::LogEntry& entries(int index) const;
+  ::raftRpcProto::LogEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::LogEntry >&
+      entries() const;
 
-  // bool VoteGranted = 2;
-  void clear_votegranted();
-  bool votegranted() const;
-  void set_votegranted(bool value);
+  // int32 Term = 1;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
   private:
-  bool _internal_votegranted() const;
-  void _internal_set_votegranted(bool value);
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
   public:
 
-  // int32 VoteState = 3;
-  void clear_votestate();
-  ::PROTOBUF_NAMESPACE_ID::int32 votestate() const;
-  void set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // int32 LeaderId = 2;
+  void clear_leaderid();
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_votestate() const;
-  void _internal_set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:raftRpcProto.RequestVoteReply)
+  // int32 PrevLogIndex = 3;
+  void clear_prevlogindex();
+  int32_t prevlogindex() const;
+  void set_prevlogindex(int32_t value);
+  private:
+  int32_t _internal_prevlogindex() const;
+  void _internal_set_prevlogindex(int32_t value);
+  public:
+
+  // int32 PrevLogTerm = 4;
+  void clear_prevlogterm();
+  int32_t prevlogterm() const;
+  void set_prevlogterm(int32_t value);
+  private:
+  int32_t _internal_prevlogterm() const;
+  void _internal_set_prevlogterm(int32_t value);
+  public:
+
+  // int32 LeaderCommit = 6;
+  void clear_leadercommit();
+  int32_t leadercommit() const;
+  void set_leadercommit(int32_t value);
+  private:
+  int32_t _internal_leadercommit() const;
+  void _internal_set_leadercommit(int32_t value);
+  public:
+
+  // int32 GroupId = 7;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProto.AppendEntriesArgs)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  bool votegranted_;
-  ::PROTOBUF_NAMESPACE_ID::int32 votestate_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::LogEntry > entries_;
+    int32_t term_;
+    int32_t leaderid_;
+    int32_t prevlogindex_;
+    int32_t prevlogterm_;
+    int32_t leadercommit_;
+    int32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class InstallSnapshotRequest PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.InstallSnapshotRequest) */ {
+class AppendEntriesReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.AppendEntriesReply) */ {
  public:
-  inline InstallSnapshotRequest() : InstallSnapshotRequest(nullptr) {};
-  virtual ~InstallSnapshotRequest();
+  inline AppendEntriesReply() : AppendEntriesReply(nullptr) {}
+  ~AppendEntriesReply() override;
+  explicit PROTOBUF_CONSTEXPR AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  InstallSnapshotRequest(const InstallSnapshotRequest& from);
-  InstallSnapshotRequest(InstallSnapshotRequest&& from) noexcept
-    : InstallSnapshotRequest() {
+  AppendEntriesReply(const AppendEntriesReply& from);
+  AppendEntriesReply(AppendEntriesReply&& from) noexcept
+    : AppendEntriesReply() {
     *this = ::std::move(from);
   }
 
-  inline InstallSnapshotRequest& operator=(const InstallSnapshotRequest& from) {
+  inline AppendEntriesReply& operator=(const AppendEntriesReply& from) {
     CopyFrom(from);
     return *this;
   }
-  inline InstallSnapshotRequest& operator=(InstallSnapshotRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline AppendEntriesReply& operator=(AppendEntriesReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -995,193 +1263,1818 @@ class InstallSnapshotRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const InstallSnapshotRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const InstallSnapshotRequest* internal_default_instance() {
-    return reinterpret_cast<const InstallSnapshotRequest*>(
-               &_InstallSnapshotRequest_default_instance_);
+  static const AppendEntriesReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AppendEntriesReply* internal_default_instance() {
+    return reinterpret_cast<const AppendEntriesReply*>(
+               &_AppendEntriesReply_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     5;
 
-  friend void swap(InstallSnapshotRequest& a, InstallSnapshotRequest& b) {
+  friend void swap(AppendEntriesReply& a, AppendEntriesReply& b) {
     a.Swap(&b);
   }
-  inline void Swap(InstallSnapshotRequest* other) {
+  inline void Swap(AppendEntriesReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(InstallSnapshotRequest* other) {
+  void UnsafeArenaSwap(AppendEntriesReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline InstallSnapshotRequest* New() const final {
-    return CreateMaybeMessage<InstallSnapshotRequest>(nullptr);
+  AppendEntriesReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AppendEntriesReply>(arena);
   }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AppendEntriesReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AppendEntriesReply& from) {
+    AppendEntriesReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  InstallSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<InstallSnapshotRequest>(arena);
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AppendEntriesReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProto.AppendEntriesReply";
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const InstallSnapshotRequest& from);
-  void MergeFrom(const InstallSnapshotRequest& from);
+  protected:
+  explicit AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kSuccessFieldNumber = 2,
+    kUpdateNextIndexFieldNumber = 3,
+    kAppStateFieldNumber = 4,
+    kConflictTermFieldNumber = 5,
+  };
+  // int32 Term = 1;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // bool Success = 2;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // int32 UpdateNextIndex = 3;
+  void clear_updatenextindex();
+  int32_t updatenextindex() const;
+  void set_updatenextindex(int32_t value);
+  private:
+  int32_t _internal_updatenextindex() const;
+  void _internal_set_updatenextindex(int32_t value);
+  public:
+
+  // int32 AppState = 4;
+  void clear_appstate();
+  int32_t appstate() const;
+  void set_appstate(int32_t value);
+  private:
+  int32_t _internal_appstate() const;
+  void _internal_set_appstate(int32_t value);
+  public:
+
+  // int32 ConflictTerm = 5;
+  void clear_conflictterm();
+  int32_t conflictterm() const;
+  void set_conflictterm(int32_t value);
+  private:
+  int32_t _internal_conflictterm() const;
+  void _internal_set_conflictterm(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProto.AppendEntriesReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t term_;
+    bool success_;
+    int32_t updatenextindex_;
+    int32_t appstate_;
+    int32_t conflictterm_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RequestVoteArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.RequestVoteArgs) */ {
+ public:
+  inline RequestVoteArgs() : RequestVoteArgs(nullptr) {}
+  ~RequestVoteArgs() override;
+  explicit PROTOBUF_CONSTEXPR RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RequestVoteArgs(const RequestVoteArgs& from);
+  RequestVoteArgs(RequestVoteArgs&& from) noexcept
+    : RequestVoteArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestVoteArgs& operator=(const RequestVoteArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestVoteArgs& operator=(RequestVoteArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestVoteArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RequestVoteArgs* internal_default_instance() {
+    return reinterpret_cast<const RequestVoteArgs*>(
+               &_RequestVoteArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(RequestVoteArgs& a, RequestVoteArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestVoteArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestVoteArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RequestVoteArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestVoteArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RequestVoteArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestVoteArgs& from) {
+    RequestVoteArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(InstallSnapshotRequest* other);
+  void InternalSwap(RequestVoteArgs* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "raftRpcProto.InstallSnapshotRequest";
+    return "raftRpcProto.RequestVoteArgs";
   }
   protected:
-  explicit InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kCandidateIdFieldNumber = 2,
+    kLastLogIndexFieldNumber = 3,
+    kLastLogTermFieldNumber = 4,
+    kPreVoteFieldNumber = 5,
+    kGroupIdFieldNumber = 6,
+  };
+  // int32 Term = 1;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // int32 CandidateId = 2;
+  void clear_candidateid();
+  int32_t candidateid() const;
+  void set_candidateid(int32_t value);
+  private:
+  int32_t _internal_candidateid() const;
+  void _internal_set_candidateid(int32_t value);
+  public:
+
+  // int32 LastLogIndex = 3;
+  void clear_lastlogindex();
+  int32_t lastlogindex() const;
+  void set_lastlogindex(int32_t value);
+  private:
+  int32_t _internal_lastlogindex() const;
+  void _internal_set_lastlogindex(int32_t value);
+  public:
+
+  // int32 LastLogTerm = 4;
+  void clear_lastlogterm();
+  int32_t lastlogterm() const;
+  void set_lastlogterm(int32_t value);
+  private:
+  int32_t _internal_lastlogterm() const;
+  void _internal_set_lastlogterm(int32_t value);
+  public:
+
+  // bool PreVote = 5;
+  void clear_prevote();
+  bool prevote() const;
+  void set_prevote(bool value);
+  private:
+  bool _internal_prevote() const;
+  void _internal_set_prevote(bool value);
+  public:
+
+  // int32 GroupId = 6;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
   private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
   public:
 
+  // @@protoc_insertion_point(class_scope:raftRpcProto.RequestVoteArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t term_;
+    int32_t candidateid_;
+    int32_t lastlogindex_;
+    int32_t lastlogterm_;
+    bool prevote_;
+    int32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RequestVoteReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.RequestVoteReply) */ {
+ public:
+  inline RequestVoteReply() : RequestVoteReply(nullptr) {}
+  ~RequestVoteReply() override;
+  explicit PROTOBUF_CONSTEXPR RequestVoteReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RequestVoteReply(const RequestVoteReply& from);
+  RequestVoteReply(RequestVoteReply&& from) noexcept
+    : RequestVoteReply() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestVoteReply& operator=(const RequestVoteReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestVoteReply& operator=(RequestVoteReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestVoteReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RequestVoteReply* internal_default_instance() {
+    return reinterpret_cast<const RequestVoteReply*>(
+               &_RequestVoteReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(RequestVoteReply& a, RequestVoteReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestVoteReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestVoteReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RequestVoteReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestVoteReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RequestVoteReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestVoteReply& from) {
+    RequestVoteReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RequestVoteReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProto.RequestVoteReply";
+  }
+  protected:
+  explicit RequestVoteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kVoteStateFieldNumber = 3,
+    kVoteGrantedFieldNumber = 2,
+    kPreVoteFieldNumber = 4,
+  };
+  // int32 Term = 1;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // int32 VoteState = 3;
+  void clear_votestate();
+  int32_t votestate() const;
+  void set_votestate(int32_t value);
+  private:
+  int32_t _internal_votestate() const;
+  void _internal_set_votestate(int32_t value);
+  public:
+
+  // bool VoteGranted = 2;
+  void clear_votegranted();
+  bool votegranted() const;
+  void set_votegranted(bool value);
+  private:
+  bool _internal_votegranted() const;
+  void _internal_set_votegranted(bool value);
+  public:
+
+  // bool PreVote = 4;
+  void clear_prevote();
+  bool prevote() const;
+  void set_prevote(bool value);
+  private:
+  bool _internal_prevote() const;
+  void _internal_set_prevote(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProto.RequestVoteReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t term_;
+    int32_t votestate_;
+    bool votegranted_;
+    bool prevote_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InstallSnapshotRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.InstallSnapshotRequest) */ {
+ public:
+  inline InstallSnapshotRequest() : InstallSnapshotRequest(nullptr) {}
+  ~InstallSnapshotRequest() override;
+  explicit PROTOBUF_CONSTEXPR InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InstallSnapshotRequest(const InstallSnapshotRequest& from);
+  InstallSnapshotRequest(InstallSnapshotRequest&& from) noexcept
+    : InstallSnapshotRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline InstallSnapshotRequest& operator=(const InstallSnapshotRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InstallSnapshotRequest& operator=(InstallSnapshotRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InstallSnapshotRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InstallSnapshotRequest* internal_default_instance() {
+    return reinterpret_cast<const InstallSnapshotRequest*>(
+               &_InstallSnapshotRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(InstallSnapshotRequest& a, InstallSnapshotRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InstallSnapshotRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InstallSnapshotRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InstallSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InstallSnapshotRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InstallSnapshotRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InstallSnapshotRequest& from) {
+    InstallSnapshotRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InstallSnapshotRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProto.InstallSnapshotRequest";
+  }
+  protected:
+  explicit InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 5,
+    kConfigFieldNumber = 9,
+    kLeaderIdFieldNumber = 1,
+    kTermFieldNumber = 2,
+    kLastSnapShotIncludeIndexFieldNumber = 3,
+    kLastSnapShotIncludeTermFieldNumber = 4,
+    kOffsetFieldNumber = 6,
+    kDoneFieldNumber = 7,
+    kGroupIdFieldNumber = 8,
+  };
+  // bytes Data = 5;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // .raftRpcProto.ClusterConfig Config = 9;
+  bool has_config() const;
+  private:
+  bool _internal_has_config() const;
+  public:
+  void clear_config();
+  const ::raftRpcProto::ClusterConfig& config() const;
+  PROTOBUF_NODISCARD ::raftRpcProto::ClusterConfig* release_config();
+  ::raftRpcProto::ClusterConfig* mutable_config();
+  void set_allocated_config(::raftRpcProto::ClusterConfig* config);
+  private:
+  const ::raftRpcProto::ClusterConfig& _internal_config() const;
+  ::raftRpcProto::ClusterConfig* _internal_mutable_config();
+  public:
+  void unsafe_arena_set_allocated_config(
+      ::raftRpcProto::ClusterConfig* config);
+  ::raftRpcProto::ClusterConfig* unsafe_arena_release_config();
+
+  // int32 LeaderId = 1;
+  void clear_leaderid();
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
+  private:
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
+  public:
+
+  // int32 Term = 2;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // int32 LastSnapShotIncludeIndex = 3;
+  void clear_lastsnapshotincludeindex();
+  int32_t lastsnapshotincludeindex() const;
+  void set_lastsnapshotincludeindex(int32_t value);
+  private:
+  int32_t _internal_lastsnapshotincludeindex() const;
+  void _internal_set_lastsnapshotincludeindex(int32_t value);
+  public:
+
+  // int32 LastSnapShotIncludeTerm = 4;
+  void clear_lastsnapshotincludeterm();
+  int32_t lastsnapshotincludeterm() const;
+  void set_lastsnapshotincludeterm(int32_t value);
+  private:
+  int32_t _internal_lastsnapshotincludeterm() const;
+  void _internal_set_lastsnapshotincludeterm(int32_t value);
+  public:
+
+  // int64 Offset = 6;
+  void clear_offset();
+  int64_t offset() const;
+  void set_offset(int64_t value);
+  private:
+  int64_t _internal_offset() const;
+  void _internal_set_offset(int64_t value);
+  public:
+
+  // bool Done = 7;
+  void clear_done();
+  bool done() const;
+  void set_done(bool value);
+  private:
+  bool _internal_done() const;
+  void _internal_set_done(bool value);
+  public:
+
+  // int32 GroupId = 8;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProto.InstallSnapshotRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::raftRpcProto::ClusterConfig* config_;
+    int32_t leaderid_;
+    int32_t term_;
+    int32_t lastsnapshotincludeindex_;
+    int32_t lastsnapshotincludeterm_;
+    int64_t offset_;
+    bool done_;
+    int32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InstallSnapshotResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.InstallSnapshotResponse) */ {
+ public:
+  inline InstallSnapshotResponse() : InstallSnapshotResponse(nullptr) {}
+  ~InstallSnapshotResponse() override;
+  explicit PROTOBUF_CONSTEXPR InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InstallSnapshotResponse(const InstallSnapshotResponse& from);
+  InstallSnapshotResponse(InstallSnapshotResponse&& from) noexcept
+    : InstallSnapshotResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline InstallSnapshotResponse& operator=(const InstallSnapshotResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InstallSnapshotResponse& operator=(InstallSnapshotResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InstallSnapshotResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InstallSnapshotResponse* internal_default_instance() {
+    return reinterpret_cast<const InstallSnapshotResponse*>(
+               &_InstallSnapshotResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(InstallSnapshotResponse& a, InstallSnapshotResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InstallSnapshotResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InstallSnapshotResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InstallSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InstallSnapshotResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InstallSnapshotResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InstallSnapshotResponse& from) {
+    InstallSnapshotResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InstallSnapshotResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProto.InstallSnapshotResponse";
+  }
+  protected:
+  explicit InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOffsetFieldNumber = 2,
+    kTermFieldNumber = 1,
+    kInstalledFieldNumber = 3,
+  };
+  // int64 Offset = 2;
+  void clear_offset();
+  int64_t offset() const;
+  void set_offset(int64_t value);
+  private:
+  int64_t _internal_offset() const;
+  void _internal_set_offset(int64_t value);
+  public:
+
+  // int32 Term = 1;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // bool Installed = 3;
+  void clear_installed();
+  bool installed() const;
+  void set_installed(bool value);
+  private:
+  bool _internal_installed() const;
+  void _internal_set_installed(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProto.InstallSnapshotResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t offset_;
+    int32_t term_;
+    bool installed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadIndexArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.ReadIndexArgs) */ {
+ public:
+  inline ReadIndexArgs() : ReadIndexArgs(nullptr) {}
+  ~ReadIndexArgs() override;
+  explicit PROTOBUF_CONSTEXPR ReadIndexArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadIndexArgs(const ReadIndexArgs& from);
+  ReadIndexArgs(ReadIndexArgs&& from) noexcept
+    : ReadIndexArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadIndexArgs& operator=(const ReadIndexArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadIndexArgs& operator=(ReadIndexArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadIndexArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadIndexArgs* internal_default_instance() {
+    return reinterpret_cast<const ReadIndexArgs*>(
+               &_ReadIndexArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(ReadIndexArgs& a, ReadIndexArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadIndexArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadIndexArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadIndexArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadIndexArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadIndexArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadIndexArgs& from) {
+    ReadIndexArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadIndexArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProto.ReadIndexArgs";
+  }
+  protected:
+  explicit ReadIndexArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kFollowerIdFieldNumber = 2,
+    kGroupIdFieldNumber = 3,
+  };
+  // int32 Term = 1;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // int32 FollowerId = 2;
+  void clear_followerid();
+  int32_t followerid() const;
+  void set_followerid(int32_t value);
+  private:
+  int32_t _internal_followerid() const;
+  void _internal_set_followerid(int32_t value);
+  public:
+
+  // int32 GroupId = 3;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProto.ReadIndexArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t term_;
+    int32_t followerid_;
+    int32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadIndexReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.ReadIndexReply) */ {
+ public:
+  inline ReadIndexReply() : ReadIndexReply(nullptr) {}
+  ~ReadIndexReply() override;
+  explicit PROTOBUF_CONSTEXPR ReadIndexReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadIndexReply(const ReadIndexReply& from);
+  ReadIndexReply(ReadIndexReply&& from) noexcept
+    : ReadIndexReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadIndexReply& operator=(const ReadIndexReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadIndexReply& operator=(ReadIndexReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadIndexReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadIndexReply* internal_default_instance() {
+    return reinterpret_cast<const ReadIndexReply*>(
+               &_ReadIndexReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(ReadIndexReply& a, ReadIndexReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadIndexReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadIndexReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadIndexReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadIndexReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadIndexReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadIndexReply& from) {
+    ReadIndexReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadIndexReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProto.ReadIndexReply";
+  }
+  protected:
+  explicit ReadIndexReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kSuccessFieldNumber = 2,
+    kReadIndexFieldNumber = 3,
+  };
+  // int32 Term = 1;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // bool Success = 2;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // int32 ReadIndex = 3;
+  void clear_readindex();
+  int32_t readindex() const;
+  void set_readindex(int32_t value);
+  private:
+  int32_t _internal_readindex() const;
+  void _internal_set_readindex(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProto.ReadIndexReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t term_;
+    bool success_;
+    int32_t readindex_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TimeoutNowArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.TimeoutNowArgs) */ {
+ public:
+  inline TimeoutNowArgs() : TimeoutNowArgs(nullptr) {}
+  ~TimeoutNowArgs() override;
+  explicit PROTOBUF_CONSTEXPR TimeoutNowArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TimeoutNowArgs(const TimeoutNowArgs& from);
+  TimeoutNowArgs(TimeoutNowArgs&& from) noexcept
+    : TimeoutNowArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline TimeoutNowArgs& operator=(const TimeoutNowArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TimeoutNowArgs& operator=(TimeoutNowArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TimeoutNowArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TimeoutNowArgs* internal_default_instance() {
+    return reinterpret_cast<const TimeoutNowArgs*>(
+               &_TimeoutNowArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(TimeoutNowArgs& a, TimeoutNowArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimeoutNowArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimeoutNowArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TimeoutNowArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TimeoutNowArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TimeoutNowArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TimeoutNowArgs& from) {
+    TimeoutNowArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimeoutNowArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProto.TimeoutNowArgs";
+  }
+  protected:
+  explicit TimeoutNowArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kLeaderIdFieldNumber = 2,
+    kGroupIdFieldNumber = 3,
+  };
+  // int32 Term = 1;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // int32 LeaderId = 2;
+  void clear_leaderid();
+  int32_t leaderid() const;
+  void set_leaderid(int32_t value);
+  private:
+  int32_t _internal_leaderid() const;
+  void _internal_set_leaderid(int32_t value);
+  public:
+
+  // int32 GroupId = 3;
+  void clear_groupid();
+  int32_t groupid() const;
+  void set_groupid(int32_t value);
+  private:
+  int32_t _internal_groupid() const;
+  void _internal_set_groupid(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProto.TimeoutNowArgs)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t term_;
+    int32_t leaderid_;
+    int32_t groupid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TimeoutNowReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.TimeoutNowReply) */ {
+ public:
+  inline TimeoutNowReply() : TimeoutNowReply(nullptr) {}
+  ~TimeoutNowReply() override;
+  explicit PROTOBUF_CONSTEXPR TimeoutNowReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TimeoutNowReply(const TimeoutNowReply& from);
+  TimeoutNowReply(TimeoutNowReply&& from) noexcept
+    : TimeoutNowReply() {
+    *this = ::std::move(from);
+  }
+
+  inline TimeoutNowReply& operator=(const TimeoutNowReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TimeoutNowReply& operator=(TimeoutNowReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TimeoutNowReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TimeoutNowReply* internal_default_instance() {
+    return reinterpret_cast<const TimeoutNowReply*>(
+               &_TimeoutNowReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(TimeoutNowReply& a, TimeoutNowReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimeoutNowReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimeoutNowReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TimeoutNowReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TimeoutNowReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TimeoutNowReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TimeoutNowReply& from) {
+    TimeoutNowReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimeoutNowReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProto.TimeoutNowReply";
+  }
+  protected:
+  explicit TimeoutNowReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTermFieldNumber = 1,
+    kSuccessFieldNumber = 2,
+  };
+  // int32 Term = 1;
+  void clear_term();
+  int32_t term() const;
+  void set_term(int32_t value);
+  private:
+  int32_t _internal_term() const;
+  void _internal_set_term(int32_t value);
+  public:
+
+  // bool Success = 2;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:raftRpcProto.TimeoutNowReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t term_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_raftRPC_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchAppendEntriesArgs final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.BatchAppendEntriesArgs) */ {
+ public:
+  inline BatchAppendEntriesArgs() : BatchAppendEntriesArgs(nullptr) {}
+  ~BatchAppendEntriesArgs() override;
+  explicit PROTOBUF_CONSTEXPR BatchAppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchAppendEntriesArgs(const BatchAppendEntriesArgs& from);
+  BatchAppendEntriesArgs(BatchAppendEntriesArgs&& from) noexcept
+    : BatchAppendEntriesArgs() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchAppendEntriesArgs& operator=(const BatchAppendEntriesArgs& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchAppendEntriesArgs& operator=(BatchAppendEntriesArgs&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchAppendEntriesArgs& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchAppendEntriesArgs* internal_default_instance() {
+    return reinterpret_cast<const BatchAppendEntriesArgs*>(
+               &_BatchAppendEntriesArgs_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(BatchAppendEntriesArgs& a, BatchAppendEntriesArgs& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchAppendEntriesArgs* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchAppendEntriesArgs* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchAppendEntriesArgs* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchAppendEntriesArgs>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchAppendEntriesArgs& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchAppendEntriesArgs& from) {
+    BatchAppendEntriesArgs::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchAppendEntriesArgs* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "raftRpcProto.BatchAppendEntriesArgs";
+  }
+  protected:
+  explicit BatchAppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
   ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kDataFieldNumber = 5,
-    kLeaderIdFieldNumber = 1,
-    kTermFieldNumber = 2,
-    kLastSnapShotIncludeIndexFieldNumber = 3,
-    kLastSnapShotIncludeTermFieldNumber = 4,
+    kArgsFieldNumber = 1,
   };
-  // bytes Data = 5;
-  void clear_data();
-  const std::string& data() const;
-  void set_data(const std::string& value);
-  void set_data(std::string&& value);
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  std::string* mutable_data();
-  std::string* release_data();
-  void set_allocated_data(std::string* data);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_data();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_data(
-      std::string* data);
-  private:
-  const std::string& _internal_data() const;
-  void _internal_set_data(const std::string& value);
-  std::string* _internal_mutable_data();
-  public:
-
-  // int32 LeaderId = 1;
-  void clear_leaderid();
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid() const;
-  void set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_leaderid() const;
-  void _internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // int32 Term = 2;
-  void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // int32 LastSnapShotIncludeIndex = 3;
-  void clear_lastsnapshotincludeindex();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeindex() const;
-  void set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // repeated .raftRpcProto.AppendEntriesArgs Args = 1;
+  int args_size() const;
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastsnapshotincludeindex() const;
-  void _internal_set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int _internal_args_size() const;
   public:
-
-  // int32 LastSnapShotIncludeTerm = 4;
-  void clear_lastsnapshotincludeterm();
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeterm() const;
-  void set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  void clear_args();
+  ::raftRpcProto::AppendEntriesArgs* mutable_args(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::AppendEntriesArgs >*
+      mutable_args();
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_lastsnapshotincludeterm() const;
-  void _internal_set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::raftRpcProto::AppendEntriesArgs& _internal_args(int index) const;
+  ::raftRpcProto::AppendEntriesArgs* _internal_add_args();
   public:
+  const ::raftRpcProto::AppendEntriesArgs& args(int index) const;
+  ::raftRpcProto::AppendEntriesArgs* add_args();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::AppendEntriesArgs >&
+      args() const;
 
-  // @@protoc_insertion_point(class_scope:raftRpcProto.InstallSnapshotRequest)
+  // @@protoc_insertion_point(class_scope:raftRpcProto.BatchAppendEntriesArgs)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
-  ::PROTOBUF_NAMESPACE_ID::int32 leaderid_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeindex_;
-  ::PROTOBUF_NAMESPACE_ID::int32 lastsnapshotincludeterm_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::AppendEntriesArgs > args_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // -------------------------------------------------------------------
 
-class InstallSnapshotResponse PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.InstallSnapshotResponse) */ {
+class BatchAppendEntriesReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:raftRpcProto.BatchAppendEntriesReply) */ {
  public:
-  inline InstallSnapshotResponse() : InstallSnapshotResponse(nullptr) {};
-  virtual ~InstallSnapshotResponse();
+  inline BatchAppendEntriesReply() : BatchAppendEntriesReply(nullptr) {}
+  ~BatchAppendEntriesReply() override;
+  explicit PROTOBUF_CONSTEXPR BatchAppendEntriesReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  InstallSnapshotResponse(const InstallSnapshotResponse& from);
-  InstallSnapshotResponse(InstallSnapshotResponse&& from) noexcept
-    : InstallSnapshotResponse() {
+  BatchAppendEntriesReply(const BatchAppendEntriesReply& from);
+  BatchAppendEntriesReply(BatchAppendEntriesReply&& from) noexcept
+    : BatchAppendEntriesReply() {
     *this = ::std::move(from);
   }
 
-  inline InstallSnapshotResponse& operator=(const InstallSnapshotResponse& from) {
+  inline BatchAppendEntriesReply& operator=(const BatchAppendEntriesReply& from) {
     CopyFrom(from);
     return *this;
   }
-  inline InstallSnapshotResponse& operator=(InstallSnapshotResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline BatchAppendEntriesReply& operator=(BatchAppendEntriesReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1192,110 +3085,124 @@ class InstallSnapshotResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const InstallSnapshotResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const InstallSnapshotResponse* internal_default_instance() {
-    return reinterpret_cast<const InstallSnapshotResponse*>(
-               &_InstallSnapshotResponse_default_instance_);
+  static const BatchAppendEntriesReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchAppendEntriesReply* internal_default_instance() {
+    return reinterpret_cast<const BatchAppendEntriesReply*>(
+               &_BatchAppendEntriesReply_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    15;
 
-  friend void swap(InstallSnapshotResponse& a, InstallSnapshotResponse& b) {
+  friend void swap(BatchAppendEntriesReply& a, BatchAppendEntriesReply& b) {
     a.Swap(&b);
   }
-  inline void Swap(InstallSnapshotResponse* other) {
+  inline void Swap(BatchAppendEntriesReply* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(InstallSnapshotResponse* other) {
+  void UnsafeArenaSwap(BatchAppendEntriesReply* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline InstallSnapshotResponse* New() const final {
-    return CreateMaybeMessage<InstallSnapshotResponse>(nullptr);
+  BatchAppendEntriesReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchAppendEntriesReply>(arena);
   }
-
-  InstallSnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<InstallSnapshotResponse>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchAppendEntriesReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchAppendEntriesReply& from) {
+    BatchAppendEntriesReply::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const InstallSnapshotResponse& from);
-  void MergeFrom(const InstallSnapshotResponse& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(InstallSnapshotResponse* other);
+  void InternalSwap(BatchAppendEntriesReply* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "raftRpcProto.InstallSnapshotResponse";
+    return "raftRpcProto.BatchAppendEntriesReply";
   }
   protected:
-  explicit InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit BatchAppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_raftRPC_2eproto);
-    return ::descriptor_table_raftRPC_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kTermFieldNumber = 1,
+    kRepliesFieldNumber = 1,
   };
-  // int32 Term = 1;
-  void clear_term();
-  ::PROTOBUF_NAMESPACE_ID::int32 term() const;
-  void set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // repeated .raftRpcProto.AppendEntriesReply Replies = 1;
+  int replies_size() const;
+  private:
+  int _internal_replies_size() const;
+  public:
+  void clear_replies();
+  ::raftRpcProto::AppendEntriesReply* mutable_replies(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::AppendEntriesReply >*
+      mutable_replies();
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_term() const;
-  void _internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value);
+  const ::raftRpcProto::AppendEntriesReply& _internal_replies(int index) const;
+  ::raftRpcProto::AppendEntriesReply* _internal_add_replies();
   public:
+  const ::raftRpcProto::AppendEntriesReply& replies(int index) const;
+  ::raftRpcProto::AppendEntriesReply* add_replies();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::AppendEntriesReply >&
+      replies() const;
 
-  // @@protoc_insertion_point(class_scope:raftRpcProto.InstallSnapshotResponse)
+  // @@protoc_insertion_point(class_scope:raftRpcProto.BatchAppendEntriesReply)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::int32 term_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::AppendEntriesReply > replies_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_raftRPC_2eproto;
 };
 // ===================================================================
@@ -1325,6 +3232,18 @@ class raftRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
                        const ::raftRpcProto::RequestVoteArgs* request,
                        ::raftRpcProto::RequestVoteReply* response,
                        ::google::protobuf::Closure* done);
+  virtual void ReadIndex(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProto::ReadIndexArgs* request,
+                       ::raftRpcProto::ReadIndexReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void TimeoutNow(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProto::TimeoutNowArgs* request,
+                       ::raftRpcProto::TimeoutNowReply* response,
+                       ::google::protobuf::Closure* done);
+  virtual void BatchAppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProto::BatchAppendEntriesArgs* request,
+                       ::raftRpcProto::BatchAppendEntriesReply* response,
+                       ::google::protobuf::Closure* done);
 
   // implements Service ----------------------------------------------
 
@@ -1366,6 +3285,18 @@ class raftRpc_Stub : public raftRpc {
                        const ::raftRpcProto::RequestVoteArgs* request,
                        ::raftRpcProto::RequestVoteReply* response,
                        ::google::protobuf::Closure* done);
+  void ReadIndex(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProto::ReadIndexArgs* request,
+                       ::raftRpcProto::ReadIndexReply* response,
+                       ::google::protobuf::Closure* done);
+  void TimeoutNow(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProto::TimeoutNowArgs* request,
+                       ::raftRpcProto::TimeoutNowReply* response,
+                       ::google::protobuf::Closure* done);
+  void BatchAppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::raftRpcProto::BatchAppendEntriesArgs* request,
+                       ::raftRpcProto::BatchAppendEntriesReply* response,
+                       ::google::protobuf::Closure* done);
  private:
   ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
   bool owns_channel_;
@@ -1386,54 +3317,38 @@ class raftRpc_Stub : public raftRpc {
 
 // bytes Command = 1;
 inline void LogEntry::clear_command() {
-  command_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.command_.ClearToEmpty();
 }
 inline const std::string& LogEntry::command() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.LogEntry.Command)
   return _internal_command();
 }
-inline void LogEntry::set_command(const std::string& value) {
-  _internal_set_command(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LogEntry::set_command(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.command_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftRpcProto.LogEntry.Command)
 }
 inline std::string* LogEntry::mutable_command() {
+  std::string* _s = _internal_mutable_command();
   // @@protoc_insertion_point(field_mutable:raftRpcProto.LogEntry.Command)
-  return _internal_mutable_command();
+  return _s;
 }
 inline const std::string& LogEntry::_internal_command() const {
-  return command_.Get();
+  return _impl_.command_.Get();
 }
 inline void LogEntry::_internal_set_command(const std::string& value) {
   
-  command_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void LogEntry::set_command(std::string&& value) {
-  
-  command_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftRpcProto.LogEntry.Command)
-}
-inline void LogEntry::set_command(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  command_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftRpcProto.LogEntry.Command)
-}
-inline void LogEntry::set_command(const void* value,
-    size_t size) {
-  
-  command_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftRpcProto.LogEntry.Command)
+  _impl_.command_.Set(value, GetArenaForAllocation());
 }
 inline std::string* LogEntry::_internal_mutable_command() {
   
-  return command_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.command_.Mutable(GetArenaForAllocation());
 }
 inline std::string* LogEntry::release_command() {
   // @@protoc_insertion_point(field_release:raftRpcProto.LogEntry.Command)
-  return command_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.command_.Release();
 }
 inline void LogEntry::set_allocated_command(std::string* command) {
   if (command != nullptr) {
@@ -1441,243 +3356,746 @@ inline void LogEntry::set_allocated_command(std::string* command) {
   } else {
     
   }
-  command_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), command,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:raftRpcProto.LogEntry.Command)
-}
-inline std::string* LogEntry::unsafe_arena_release_command() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftRpcProto.LogEntry.Command)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return command_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void LogEntry::unsafe_arena_set_allocated_command(
-    std::string* command) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (command != nullptr) {
-    
-  } else {
-    
+  _impl_.command_.SetAllocated(command, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.command_.IsDefault()) {
+    _impl_.command_.Set("", GetArenaForAllocation());
   }
-  command_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      command, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftRpcProto.LogEntry.Command)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProto.LogEntry.Command)
 }
 
 // int32 LogTerm = 2;
 inline void LogEntry::clear_logterm() {
-  logterm_ = 0;
+  _impl_.logterm_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::_internal_logterm() const {
-  return logterm_;
+inline int32_t LogEntry::_internal_logterm() const {
+  return _impl_.logterm_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::logterm() const {
+inline int32_t LogEntry::logterm() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.LogEntry.LogTerm)
   return _internal_logterm();
 }
-inline void LogEntry::_internal_set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void LogEntry::_internal_set_logterm(int32_t value) {
   
-  logterm_ = value;
+  _impl_.logterm_ = value;
 }
-inline void LogEntry::set_logterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void LogEntry::set_logterm(int32_t value) {
   _internal_set_logterm(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.LogEntry.LogTerm)
 }
 
 // int32 LogIndex = 3;
 inline void LogEntry::clear_logindex() {
-  logindex_ = 0;
+  _impl_.logindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::_internal_logindex() const {
-  return logindex_;
+inline int32_t LogEntry::_internal_logindex() const {
+  return _impl_.logindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 LogEntry::logindex() const {
+inline int32_t LogEntry::logindex() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.LogEntry.LogIndex)
   return _internal_logindex();
 }
-inline void LogEntry::_internal_set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void LogEntry::_internal_set_logindex(int32_t value) {
   
-  logindex_ = value;
+  _impl_.logindex_ = value;
 }
-inline void LogEntry::set_logindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void LogEntry::set_logindex(int32_t value) {
   _internal_set_logindex(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.LogEntry.LogIndex)
 }
 
+// .raftRpcProto.EntryType Type = 4;
+inline void LogEntry::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::raftRpcProto::EntryType LogEntry::_internal_type() const {
+  return static_cast< ::raftRpcProto::EntryType >(_impl_.type_);
+}
+inline ::raftRpcProto::EntryType LogEntry::type() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.LogEntry.Type)
+  return _internal_type();
+}
+inline void LogEntry::_internal_set_type(::raftRpcProto::EntryType value) {
+  
+  _impl_.type_ = value;
+}
+inline void LogEntry::set_type(::raftRpcProto::EntryType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.LogEntry.Type)
+}
+
+// -------------------------------------------------------------------
+
+// PeerAddr
+
+// int32 NodeId = 1;
+inline void PeerAddr::clear_nodeid() {
+  _impl_.nodeid_ = 0;
+}
+inline int32_t PeerAddr::_internal_nodeid() const {
+  return _impl_.nodeid_;
+}
+inline int32_t PeerAddr::nodeid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.PeerAddr.NodeId)
+  return _internal_nodeid();
+}
+inline void PeerAddr::_internal_set_nodeid(int32_t value) {
+  
+  _impl_.nodeid_ = value;
+}
+inline void PeerAddr::set_nodeid(int32_t value) {
+  _internal_set_nodeid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.PeerAddr.NodeId)
+}
+
+// string Ip = 2;
+inline void PeerAddr::clear_ip() {
+  _impl_.ip_.ClearToEmpty();
+}
+inline const std::string& PeerAddr::ip() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.PeerAddr.Ip)
+  return _internal_ip();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PeerAddr::set_ip(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ip_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:raftRpcProto.PeerAddr.Ip)
+}
+inline std::string* PeerAddr::mutable_ip() {
+  std::string* _s = _internal_mutable_ip();
+  // @@protoc_insertion_point(field_mutable:raftRpcProto.PeerAddr.Ip)
+  return _s;
+}
+inline const std::string& PeerAddr::_internal_ip() const {
+  return _impl_.ip_.Get();
+}
+inline void PeerAddr::_internal_set_ip(const std::string& value) {
+  
+  _impl_.ip_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PeerAddr::_internal_mutable_ip() {
+  
+  return _impl_.ip_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PeerAddr::release_ip() {
+  // @@protoc_insertion_point(field_release:raftRpcProto.PeerAddr.Ip)
+  return _impl_.ip_.Release();
+}
+inline void PeerAddr::set_allocated_ip(std::string* ip) {
+  if (ip != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.ip_.SetAllocated(ip, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_.IsDefault()) {
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProto.PeerAddr.Ip)
+}
+
+// int32 Port = 3;
+inline void PeerAddr::clear_port() {
+  _impl_.port_ = 0;
+}
+inline int32_t PeerAddr::_internal_port() const {
+  return _impl_.port_;
+}
+inline int32_t PeerAddr::port() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.PeerAddr.Port)
+  return _internal_port();
+}
+inline void PeerAddr::_internal_set_port(int32_t value) {
+  
+  _impl_.port_ = value;
+}
+inline void PeerAddr::set_port(int32_t value) {
+  _internal_set_port(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.PeerAddr.Port)
+}
+
+// -------------------------------------------------------------------
+
+// ConfChange
+
+// .raftRpcProto.ConfChangeType Type = 1;
+inline void ConfChange::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::raftRpcProto::ConfChangeType ConfChange::_internal_type() const {
+  return static_cast< ::raftRpcProto::ConfChangeType >(_impl_.type_);
+}
+inline ::raftRpcProto::ConfChangeType ConfChange::type() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ConfChange.Type)
+  return _internal_type();
+}
+inline void ConfChange::_internal_set_type(::raftRpcProto::ConfChangeType value) {
+  
+  _impl_.type_ = value;
+}
+inline void ConfChange::set_type(::raftRpcProto::ConfChangeType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.ConfChange.Type)
+}
+
+// int32 NodeId = 2;
+inline void ConfChange::clear_nodeid() {
+  _impl_.nodeid_ = 0;
+}
+inline int32_t ConfChange::_internal_nodeid() const {
+  return _impl_.nodeid_;
+}
+inline int32_t ConfChange::nodeid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ConfChange.NodeId)
+  return _internal_nodeid();
+}
+inline void ConfChange::_internal_set_nodeid(int32_t value) {
+  
+  _impl_.nodeid_ = value;
+}
+inline void ConfChange::set_nodeid(int32_t value) {
+  _internal_set_nodeid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.ConfChange.NodeId)
+}
+
+// repeated int32 Voters = 3;
+inline int ConfChange::_internal_voters_size() const {
+  return _impl_.voters_.size();
+}
+inline int ConfChange::voters_size() const {
+  return _internal_voters_size();
+}
+inline void ConfChange::clear_voters() {
+  _impl_.voters_.Clear();
+}
+inline int32_t ConfChange::_internal_voters(int index) const {
+  return _impl_.voters_.Get(index);
+}
+inline int32_t ConfChange::voters(int index) const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ConfChange.Voters)
+  return _internal_voters(index);
+}
+inline void ConfChange::set_voters(int index, int32_t value) {
+  _impl_.voters_.Set(index, value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.ConfChange.Voters)
+}
+inline void ConfChange::_internal_add_voters(int32_t value) {
+  _impl_.voters_.Add(value);
+}
+inline void ConfChange::add_voters(int32_t value) {
+  _internal_add_voters(value);
+  // @@protoc_insertion_point(field_add:raftRpcProto.ConfChange.Voters)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ConfChange::_internal_voters() const {
+  return _impl_.voters_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ConfChange::voters() const {
+  // @@protoc_insertion_point(field_list:raftRpcProto.ConfChange.Voters)
+  return _internal_voters();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ConfChange::_internal_mutable_voters() {
+  return &_impl_.voters_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ConfChange::mutable_voters() {
+  // @@protoc_insertion_point(field_mutable_list:raftRpcProto.ConfChange.Voters)
+  return _internal_mutable_voters();
+}
+
+// repeated .raftRpcProto.PeerAddr Addrs = 4;
+inline int ConfChange::_internal_addrs_size() const {
+  return _impl_.addrs_.size();
+}
+inline int ConfChange::addrs_size() const {
+  return _internal_addrs_size();
+}
+inline void ConfChange::clear_addrs() {
+  _impl_.addrs_.Clear();
+}
+inline ::raftRpcProto::PeerAddr* ConfChange::mutable_addrs(int index) {
+  // @@protoc_insertion_point(field_mutable:raftRpcProto.ConfChange.Addrs)
+  return _impl_.addrs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::PeerAddr >*
+ConfChange::mutable_addrs() {
+  // @@protoc_insertion_point(field_mutable_list:raftRpcProto.ConfChange.Addrs)
+  return &_impl_.addrs_;
+}
+inline const ::raftRpcProto::PeerAddr& ConfChange::_internal_addrs(int index) const {
+  return _impl_.addrs_.Get(index);
+}
+inline const ::raftRpcProto::PeerAddr& ConfChange::addrs(int index) const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ConfChange.Addrs)
+  return _internal_addrs(index);
+}
+inline ::raftRpcProto::PeerAddr* ConfChange::_internal_add_addrs() {
+  return _impl_.addrs_.Add();
+}
+inline ::raftRpcProto::PeerAddr* ConfChange::add_addrs() {
+  ::raftRpcProto::PeerAddr* _add = _internal_add_addrs();
+  // @@protoc_insertion_point(field_add:raftRpcProto.ConfChange.Addrs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::PeerAddr >&
+ConfChange::addrs() const {
+  // @@protoc_insertion_point(field_list:raftRpcProto.ConfChange.Addrs)
+  return _impl_.addrs_;
+}
+
+// -------------------------------------------------------------------
+
+// ClusterConfig
+
+// repeated int32 Voters = 1;
+inline int ClusterConfig::_internal_voters_size() const {
+  return _impl_.voters_.size();
+}
+inline int ClusterConfig::voters_size() const {
+  return _internal_voters_size();
+}
+inline void ClusterConfig::clear_voters() {
+  _impl_.voters_.Clear();
+}
+inline int32_t ClusterConfig::_internal_voters(int index) const {
+  return _impl_.voters_.Get(index);
+}
+inline int32_t ClusterConfig::voters(int index) const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ClusterConfig.Voters)
+  return _internal_voters(index);
+}
+inline void ClusterConfig::set_voters(int index, int32_t value) {
+  _impl_.voters_.Set(index, value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.ClusterConfig.Voters)
+}
+inline void ClusterConfig::_internal_add_voters(int32_t value) {
+  _impl_.voters_.Add(value);
+}
+inline void ClusterConfig::add_voters(int32_t value) {
+  _internal_add_voters(value);
+  // @@protoc_insertion_point(field_add:raftRpcProto.ClusterConfig.Voters)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ClusterConfig::_internal_voters() const {
+  return _impl_.voters_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ClusterConfig::voters() const {
+  // @@protoc_insertion_point(field_list:raftRpcProto.ClusterConfig.Voters)
+  return _internal_voters();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ClusterConfig::_internal_mutable_voters() {
+  return &_impl_.voters_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ClusterConfig::mutable_voters() {
+  // @@protoc_insertion_point(field_mutable_list:raftRpcProto.ClusterConfig.Voters)
+  return _internal_mutable_voters();
+}
+
+// repeated int32 Learners = 2;
+inline int ClusterConfig::_internal_learners_size() const {
+  return _impl_.learners_.size();
+}
+inline int ClusterConfig::learners_size() const {
+  return _internal_learners_size();
+}
+inline void ClusterConfig::clear_learners() {
+  _impl_.learners_.Clear();
+}
+inline int32_t ClusterConfig::_internal_learners(int index) const {
+  return _impl_.learners_.Get(index);
+}
+inline int32_t ClusterConfig::learners(int index) const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ClusterConfig.Learners)
+  return _internal_learners(index);
+}
+inline void ClusterConfig::set_learners(int index, int32_t value) {
+  _impl_.learners_.Set(index, value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.ClusterConfig.Learners)
+}
+inline void ClusterConfig::_internal_add_learners(int32_t value) {
+  _impl_.learners_.Add(value);
+}
+inline void ClusterConfig::add_learners(int32_t value) {
+  _internal_add_learners(value);
+  // @@protoc_insertion_point(field_add:raftRpcProto.ClusterConfig.Learners)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ClusterConfig::_internal_learners() const {
+  return _impl_.learners_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ClusterConfig::learners() const {
+  // @@protoc_insertion_point(field_list:raftRpcProto.ClusterConfig.Learners)
+  return _internal_learners();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ClusterConfig::_internal_mutable_learners() {
+  return &_impl_.learners_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ClusterConfig::mutable_learners() {
+  // @@protoc_insertion_point(field_mutable_list:raftRpcProto.ClusterConfig.Learners)
+  return _internal_mutable_learners();
+}
+
+// int32 Index = 3;
+inline void ClusterConfig::clear_index() {
+  _impl_.index_ = 0;
+}
+inline int32_t ClusterConfig::_internal_index() const {
+  return _impl_.index_;
+}
+inline int32_t ClusterConfig::index() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ClusterConfig.Index)
+  return _internal_index();
+}
+inline void ClusterConfig::_internal_set_index(int32_t value) {
+  
+  _impl_.index_ = value;
+}
+inline void ClusterConfig::set_index(int32_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.ClusterConfig.Index)
+}
+
+// repeated int32 OutgoingVoters = 4;
+inline int ClusterConfig::_internal_outgoingvoters_size() const {
+  return _impl_.outgoingvoters_.size();
+}
+inline int ClusterConfig::outgoingvoters_size() const {
+  return _internal_outgoingvoters_size();
+}
+inline void ClusterConfig::clear_outgoingvoters() {
+  _impl_.outgoingvoters_.Clear();
+}
+inline int32_t ClusterConfig::_internal_outgoingvoters(int index) const {
+  return _impl_.outgoingvoters_.Get(index);
+}
+inline int32_t ClusterConfig::outgoingvoters(int index) const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ClusterConfig.OutgoingVoters)
+  return _internal_outgoingvoters(index);
+}
+inline void ClusterConfig::set_outgoingvoters(int index, int32_t value) {
+  _impl_.outgoingvoters_.Set(index, value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.ClusterConfig.OutgoingVoters)
+}
+inline void ClusterConfig::_internal_add_outgoingvoters(int32_t value) {
+  _impl_.outgoingvoters_.Add(value);
+}
+inline void ClusterConfig::add_outgoingvoters(int32_t value) {
+  _internal_add_outgoingvoters(value);
+  // @@protoc_insertion_point(field_add:raftRpcProto.ClusterConfig.OutgoingVoters)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ClusterConfig::_internal_outgoingvoters() const {
+  return _impl_.outgoingvoters_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ClusterConfig::outgoingvoters() const {
+  // @@protoc_insertion_point(field_list:raftRpcProto.ClusterConfig.OutgoingVoters)
+  return _internal_outgoingvoters();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ClusterConfig::_internal_mutable_outgoingvoters() {
+  return &_impl_.outgoingvoters_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ClusterConfig::mutable_outgoingvoters() {
+  // @@protoc_insertion_point(field_mutable_list:raftRpcProto.ClusterConfig.OutgoingVoters)
+  return _internal_mutable_outgoingvoters();
+}
+
+// repeated .raftRpcProto.PeerAddr Addrs = 5;
+inline int ClusterConfig::_internal_addrs_size() const {
+  return _impl_.addrs_.size();
+}
+inline int ClusterConfig::addrs_size() const {
+  return _internal_addrs_size();
+}
+inline void ClusterConfig::clear_addrs() {
+  _impl_.addrs_.Clear();
+}
+inline ::raftRpcProto::PeerAddr* ClusterConfig::mutable_addrs(int index) {
+  // @@protoc_insertion_point(field_mutable:raftRpcProto.ClusterConfig.Addrs)
+  return _impl_.addrs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::PeerAddr >*
+ClusterConfig::mutable_addrs() {
+  // @@protoc_insertion_point(field_mutable_list:raftRpcProto.ClusterConfig.Addrs)
+  return &_impl_.addrs_;
+}
+inline const ::raftRpcProto::PeerAddr& ClusterConfig::_internal_addrs(int index) const {
+  return _impl_.addrs_.Get(index);
+}
+inline const ::raftRpcProto::PeerAddr& ClusterConfig::addrs(int index) const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ClusterConfig.Addrs)
+  return _internal_addrs(index);
+}
+inline ::raftRpcProto::PeerAddr* ClusterConfig::_internal_add_addrs() {
+  return _impl_.addrs_.Add();
+}
+inline ::raftRpcProto::PeerAddr* ClusterConfig::add_addrs() {
+  ::raftRpcProto::PeerAddr* _add = _internal_add_addrs();
+  // @@protoc_insertion_point(field_add:raftRpcProto.ClusterConfig.Addrs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::PeerAddr >&
+ClusterConfig::addrs() const {
+  // @@protoc_insertion_point(field_list:raftRpcProto.ClusterConfig.Addrs)
+  return _impl_.addrs_;
+}
+
+// repeated int32 Witnesses = 6;
+inline int ClusterConfig::_internal_witnesses_size() const {
+  return _impl_.witnesses_.size();
+}
+inline int ClusterConfig::witnesses_size() const {
+  return _internal_witnesses_size();
+}
+inline void ClusterConfig::clear_witnesses() {
+  _impl_.witnesses_.Clear();
+}
+inline int32_t ClusterConfig::_internal_witnesses(int index) const {
+  return _impl_.witnesses_.Get(index);
+}
+inline int32_t ClusterConfig::witnesses(int index) const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ClusterConfig.Witnesses)
+  return _internal_witnesses(index);
+}
+inline void ClusterConfig::set_witnesses(int index, int32_t value) {
+  _impl_.witnesses_.Set(index, value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.ClusterConfig.Witnesses)
+}
+inline void ClusterConfig::_internal_add_witnesses(int32_t value) {
+  _impl_.witnesses_.Add(value);
+}
+inline void ClusterConfig::add_witnesses(int32_t value) {
+  _internal_add_witnesses(value);
+  // @@protoc_insertion_point(field_add:raftRpcProto.ClusterConfig.Witnesses)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ClusterConfig::_internal_witnesses() const {
+  return _impl_.witnesses_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ClusterConfig::witnesses() const {
+  // @@protoc_insertion_point(field_list:raftRpcProto.ClusterConfig.Witnesses)
+  return _internal_witnesses();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ClusterConfig::_internal_mutable_witnesses() {
+  return &_impl_.witnesses_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ClusterConfig::mutable_witnesses() {
+  // @@protoc_insertion_point(field_mutable_list:raftRpcProto.ClusterConfig.Witnesses)
+  return _internal_mutable_witnesses();
+}
+
 // -------------------------------------------------------------------
 
 // AppendEntriesArgs
 
 // int32 Term = 1;
 inline void AppendEntriesArgs::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_term() const {
-  return term_;
+inline int32_t AppendEntriesArgs::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::term() const {
+inline int32_t AppendEntriesArgs::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.AppendEntriesArgs.Term)
   return _internal_term();
 }
-inline void AppendEntriesArgs::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::_internal_set_term(int32_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
 }
-inline void AppendEntriesArgs::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.AppendEntriesArgs.Term)
 }
 
 // int32 LeaderId = 2;
 inline void AppendEntriesArgs::clear_leaderid() {
-  leaderid_ = 0;
+  _impl_.leaderid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_leaderid() const {
-  return leaderid_;
+inline int32_t AppendEntriesArgs::_internal_leaderid() const {
+  return _impl_.leaderid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::leaderid() const {
+inline int32_t AppendEntriesArgs::leaderid() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.AppendEntriesArgs.LeaderId)
   return _internal_leaderid();
 }
-inline void AppendEntriesArgs::_internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::_internal_set_leaderid(int32_t value) {
   
-  leaderid_ = value;
+  _impl_.leaderid_ = value;
 }
-inline void AppendEntriesArgs::set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::set_leaderid(int32_t value) {
   _internal_set_leaderid(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.AppendEntriesArgs.LeaderId)
 }
 
 // int32 PrevLogIndex = 3;
 inline void AppendEntriesArgs::clear_prevlogindex() {
-  prevlogindex_ = 0;
+  _impl_.prevlogindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_prevlogindex() const {
-  return prevlogindex_;
+inline int32_t AppendEntriesArgs::_internal_prevlogindex() const {
+  return _impl_.prevlogindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::prevlogindex() const {
+inline int32_t AppendEntriesArgs::prevlogindex() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.AppendEntriesArgs.PrevLogIndex)
   return _internal_prevlogindex();
 }
-inline void AppendEntriesArgs::_internal_set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::_internal_set_prevlogindex(int32_t value) {
   
-  prevlogindex_ = value;
+  _impl_.prevlogindex_ = value;
 }
-inline void AppendEntriesArgs::set_prevlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::set_prevlogindex(int32_t value) {
   _internal_set_prevlogindex(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.AppendEntriesArgs.PrevLogIndex)
 }
 
 // int32 PrevLogTerm = 4;
 inline void AppendEntriesArgs::clear_prevlogterm() {
-  prevlogterm_ = 0;
+  _impl_.prevlogterm_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_prevlogterm() const {
-  return prevlogterm_;
+inline int32_t AppendEntriesArgs::_internal_prevlogterm() const {
+  return _impl_.prevlogterm_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::prevlogterm() const {
+inline int32_t AppendEntriesArgs::prevlogterm() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.AppendEntriesArgs.PrevLogTerm)
   return _internal_prevlogterm();
 }
-inline void AppendEntriesArgs::_internal_set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::_internal_set_prevlogterm(int32_t value) {
   
-  prevlogterm_ = value;
+  _impl_.prevlogterm_ = value;
 }
-inline void AppendEntriesArgs::set_prevlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::set_prevlogterm(int32_t value) {
   _internal_set_prevlogterm(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.AppendEntriesArgs.PrevLogTerm)
 }
 
 // repeated .raftRpcProto.LogEntry Entries = 5;
 inline int AppendEntriesArgs::_internal_entries_size() const {
-  return entries_.size();
+  return _impl_.entries_.size();
 }
 inline int AppendEntriesArgs::entries_size() const {
   return _internal_entries_size();
 }
 inline void AppendEntriesArgs::clear_entries() {
-  entries_.Clear();
+  _impl_.entries_.Clear();
 }
 inline ::raftRpcProto::LogEntry* AppendEntriesArgs::mutable_entries(int index) {
   // @@protoc_insertion_point(field_mutable:raftRpcProto.AppendEntriesArgs.Entries)
-  return entries_.Mutable(index);
+  return _impl_.entries_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::LogEntry >*
 AppendEntriesArgs::mutable_entries() {
   // @@protoc_insertion_point(field_mutable_list:raftRpcProto.AppendEntriesArgs.Entries)
-  return &entries_;
+  return &_impl_.entries_;
 }
 inline const ::raftRpcProto::LogEntry& AppendEntriesArgs::_internal_entries(int index) const {
-  return entries_.Get(index);
+  return _impl_.entries_.Get(index);
 }
 inline const ::raftRpcProto::LogEntry& AppendEntriesArgs::entries(int index) const {
   // @@protoc_insertion_point(field_get:raftRpcProto.AppendEntriesArgs.Entries)
   return _internal_entries(index);
 }
 inline ::raftRpcProto::LogEntry* AppendEntriesArgs::_internal_add_entries() {
-  return entries_.Add();
+  return _impl_.entries_.Add();
 }
 inline ::raftRpcProto::LogEntry* AppendEntriesArgs::add_entries() {
+  ::raftRpcProto::LogEntry* _add = _internal_add_entries();
   // @@protoc_insertion_point(field_add:raftRpcProto.AppendEntriesArgs.Entries)
-  return _internal_add_entries();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::LogEntry >&
 AppendEntriesArgs::entries() const {
   // @@protoc_insertion_point(field_list:raftRpcProto.AppendEntriesArgs.Entries)
-  return entries_;
+  return _impl_.entries_;
 }
 
 // int32 LeaderCommit = 6;
 inline void AppendEntriesArgs::clear_leadercommit() {
-  leadercommit_ = 0;
+  _impl_.leadercommit_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::_internal_leadercommit() const {
-  return leadercommit_;
+inline int32_t AppendEntriesArgs::_internal_leadercommit() const {
+  return _impl_.leadercommit_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesArgs::leadercommit() const {
+inline int32_t AppendEntriesArgs::leadercommit() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.AppendEntriesArgs.LeaderCommit)
   return _internal_leadercommit();
 }
-inline void AppendEntriesArgs::_internal_set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::_internal_set_leadercommit(int32_t value) {
   
-  leadercommit_ = value;
+  _impl_.leadercommit_ = value;
 }
-inline void AppendEntriesArgs::set_leadercommit(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesArgs::set_leadercommit(int32_t value) {
   _internal_set_leadercommit(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.AppendEntriesArgs.LeaderCommit)
 }
 
+// int32 GroupId = 7;
+inline void AppendEntriesArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
+}
+inline int32_t AppendEntriesArgs::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t AppendEntriesArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.AppendEntriesArgs.GroupId)
+  return _internal_groupid();
+}
+inline void AppendEntriesArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void AppendEntriesArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.AppendEntriesArgs.GroupId)
+}
+
 // -------------------------------------------------------------------
 
 // AppendEntriesReply
 
 // int32 Term = 1;
 inline void AppendEntriesReply::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::_internal_term() const {
-  return term_;
+inline int32_t AppendEntriesReply::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::term() const {
+inline int32_t AppendEntriesReply::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.AppendEntriesReply.Term)
   return _internal_term();
 }
-inline void AppendEntriesReply::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesReply::_internal_set_term(int32_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
 }
-inline void AppendEntriesReply::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesReply::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.AppendEntriesReply.Term)
 }
 
 // bool Success = 2;
 inline void AppendEntriesReply::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
 }
 inline bool AppendEntriesReply::_internal_success() const {
-  return success_;
+  return _impl_.success_;
 }
 inline bool AppendEntriesReply::success() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.AppendEntriesReply.Success)
@@ -1685,7 +4103,7 @@ inline bool AppendEntriesReply::success() const {
 }
 inline void AppendEntriesReply::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
 }
 inline void AppendEntriesReply::set_success(bool value) {
   _internal_set_success(value);
@@ -1694,158 +4112,218 @@ inline void AppendEntriesReply::set_success(bool value) {
 
 // int32 UpdateNextIndex = 3;
 inline void AppendEntriesReply::clear_updatenextindex() {
-  updatenextindex_ = 0;
+  _impl_.updatenextindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::_internal_updatenextindex() const {
-  return updatenextindex_;
+inline int32_t AppendEntriesReply::_internal_updatenextindex() const {
+  return _impl_.updatenextindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::updatenextindex() const {
+inline int32_t AppendEntriesReply::updatenextindex() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.AppendEntriesReply.UpdateNextIndex)
   return _internal_updatenextindex();
 }
-inline void AppendEntriesReply::_internal_set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesReply::_internal_set_updatenextindex(int32_t value) {
   
-  updatenextindex_ = value;
+  _impl_.updatenextindex_ = value;
 }
-inline void AppendEntriesReply::set_updatenextindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesReply::set_updatenextindex(int32_t value) {
   _internal_set_updatenextindex(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.AppendEntriesReply.UpdateNextIndex)
 }
 
 // int32 AppState = 4;
 inline void AppendEntriesReply::clear_appstate() {
-  appstate_ = 0;
+  _impl_.appstate_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::_internal_appstate() const {
-  return appstate_;
+inline int32_t AppendEntriesReply::_internal_appstate() const {
+  return _impl_.appstate_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 AppendEntriesReply::appstate() const {
+inline int32_t AppendEntriesReply::appstate() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.AppendEntriesReply.AppState)
   return _internal_appstate();
 }
-inline void AppendEntriesReply::_internal_set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesReply::_internal_set_appstate(int32_t value) {
   
-  appstate_ = value;
+  _impl_.appstate_ = value;
 }
-inline void AppendEntriesReply::set_appstate(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void AppendEntriesReply::set_appstate(int32_t value) {
   _internal_set_appstate(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.AppendEntriesReply.AppState)
 }
 
+// int32 ConflictTerm = 5;
+inline void AppendEntriesReply::clear_conflictterm() {
+  _impl_.conflictterm_ = 0;
+}
+inline int32_t AppendEntriesReply::_internal_conflictterm() const {
+  return _impl_.conflictterm_;
+}
+inline int32_t AppendEntriesReply::conflictterm() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.AppendEntriesReply.ConflictTerm)
+  return _internal_conflictterm();
+}
+inline void AppendEntriesReply::_internal_set_conflictterm(int32_t value) {
+  
+  _impl_.conflictterm_ = value;
+}
+inline void AppendEntriesReply::set_conflictterm(int32_t value) {
+  _internal_set_conflictterm(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.AppendEntriesReply.ConflictTerm)
+}
+
 // -------------------------------------------------------------------
 
 // RequestVoteArgs
 
 // int32 Term = 1;
 inline void RequestVoteArgs::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_term() const {
-  return term_;
+inline int32_t RequestVoteArgs::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::term() const {
+inline int32_t RequestVoteArgs::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.RequestVoteArgs.Term)
   return _internal_term();
 }
-inline void RequestVoteArgs::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::_internal_set_term(int32_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
 }
-inline void RequestVoteArgs::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.RequestVoteArgs.Term)
 }
 
 // int32 CandidateId = 2;
 inline void RequestVoteArgs::clear_candidateid() {
-  candidateid_ = 0;
+  _impl_.candidateid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_candidateid() const {
-  return candidateid_;
+inline int32_t RequestVoteArgs::_internal_candidateid() const {
+  return _impl_.candidateid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::candidateid() const {
+inline int32_t RequestVoteArgs::candidateid() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.RequestVoteArgs.CandidateId)
   return _internal_candidateid();
 }
-inline void RequestVoteArgs::_internal_set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::_internal_set_candidateid(int32_t value) {
   
-  candidateid_ = value;
+  _impl_.candidateid_ = value;
 }
-inline void RequestVoteArgs::set_candidateid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::set_candidateid(int32_t value) {
   _internal_set_candidateid(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.RequestVoteArgs.CandidateId)
 }
 
 // int32 LastLogIndex = 3;
 inline void RequestVoteArgs::clear_lastlogindex() {
-  lastlogindex_ = 0;
+  _impl_.lastlogindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_lastlogindex() const {
-  return lastlogindex_;
+inline int32_t RequestVoteArgs::_internal_lastlogindex() const {
+  return _impl_.lastlogindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::lastlogindex() const {
+inline int32_t RequestVoteArgs::lastlogindex() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.RequestVoteArgs.LastLogIndex)
   return _internal_lastlogindex();
 }
-inline void RequestVoteArgs::_internal_set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::_internal_set_lastlogindex(int32_t value) {
   
-  lastlogindex_ = value;
+  _impl_.lastlogindex_ = value;
 }
-inline void RequestVoteArgs::set_lastlogindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::set_lastlogindex(int32_t value) {
   _internal_set_lastlogindex(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.RequestVoteArgs.LastLogIndex)
 }
 
 // int32 LastLogTerm = 4;
 inline void RequestVoteArgs::clear_lastlogterm() {
-  lastlogterm_ = 0;
+  _impl_.lastlogterm_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::_internal_lastlogterm() const {
-  return lastlogterm_;
+inline int32_t RequestVoteArgs::_internal_lastlogterm() const {
+  return _impl_.lastlogterm_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteArgs::lastlogterm() const {
+inline int32_t RequestVoteArgs::lastlogterm() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.RequestVoteArgs.LastLogTerm)
   return _internal_lastlogterm();
 }
-inline void RequestVoteArgs::_internal_set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::_internal_set_lastlogterm(int32_t value) {
   
-  lastlogterm_ = value;
+  _impl_.lastlogterm_ = value;
 }
-inline void RequestVoteArgs::set_lastlogterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteArgs::set_lastlogterm(int32_t value) {
   _internal_set_lastlogterm(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.RequestVoteArgs.LastLogTerm)
 }
 
+// bool PreVote = 5;
+inline void RequestVoteArgs::clear_prevote() {
+  _impl_.prevote_ = false;
+}
+inline bool RequestVoteArgs::_internal_prevote() const {
+  return _impl_.prevote_;
+}
+inline bool RequestVoteArgs::prevote() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.RequestVoteArgs.PreVote)
+  return _internal_prevote();
+}
+inline void RequestVoteArgs::_internal_set_prevote(bool value) {
+  
+  _impl_.prevote_ = value;
+}
+inline void RequestVoteArgs::set_prevote(bool value) {
+  _internal_set_prevote(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.RequestVoteArgs.PreVote)
+}
+
+// int32 GroupId = 6;
+inline void RequestVoteArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
+}
+inline int32_t RequestVoteArgs::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t RequestVoteArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.RequestVoteArgs.GroupId)
+  return _internal_groupid();
+}
+inline void RequestVoteArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void RequestVoteArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.RequestVoteArgs.GroupId)
+}
+
 // -------------------------------------------------------------------
 
 // RequestVoteReply
 
 // int32 Term = 1;
 inline void RequestVoteReply::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::_internal_term() const {
-  return term_;
+inline int32_t RequestVoteReply::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::term() const {
+inline int32_t RequestVoteReply::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.RequestVoteReply.Term)
   return _internal_term();
 }
-inline void RequestVoteReply::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteReply::_internal_set_term(int32_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
 }
-inline void RequestVoteReply::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteReply::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.RequestVoteReply.Term)
 }
 
 // bool VoteGranted = 2;
 inline void RequestVoteReply::clear_votegranted() {
-  votegranted_ = false;
+  _impl_.votegranted_ = false;
 }
 inline bool RequestVoteReply::_internal_votegranted() const {
-  return votegranted_;
+  return _impl_.votegranted_;
 }
 inline bool RequestVoteReply::votegranted() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.RequestVoteReply.VoteGranted)
@@ -1853,7 +4331,7 @@ inline bool RequestVoteReply::votegranted() const {
 }
 inline void RequestVoteReply::_internal_set_votegranted(bool value) {
   
-  votegranted_ = value;
+  _impl_.votegranted_ = value;
 }
 inline void RequestVoteReply::set_votegranted(bool value) {
   _internal_set_votegranted(value);
@@ -1862,158 +4340,162 @@ inline void RequestVoteReply::set_votegranted(bool value) {
 
 // int32 VoteState = 3;
 inline void RequestVoteReply::clear_votestate() {
-  votestate_ = 0;
+  _impl_.votestate_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::_internal_votestate() const {
-  return votestate_;
+inline int32_t RequestVoteReply::_internal_votestate() const {
+  return _impl_.votestate_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RequestVoteReply::votestate() const {
+inline int32_t RequestVoteReply::votestate() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.RequestVoteReply.VoteState)
   return _internal_votestate();
 }
-inline void RequestVoteReply::_internal_set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteReply::_internal_set_votestate(int32_t value) {
   
-  votestate_ = value;
+  _impl_.votestate_ = value;
 }
-inline void RequestVoteReply::set_votestate(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RequestVoteReply::set_votestate(int32_t value) {
   _internal_set_votestate(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.RequestVoteReply.VoteState)
 }
 
+// bool PreVote = 4;
+inline void RequestVoteReply::clear_prevote() {
+  _impl_.prevote_ = false;
+}
+inline bool RequestVoteReply::_internal_prevote() const {
+  return _impl_.prevote_;
+}
+inline bool RequestVoteReply::prevote() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.RequestVoteReply.PreVote)
+  return _internal_prevote();
+}
+inline void RequestVoteReply::_internal_set_prevote(bool value) {
+  
+  _impl_.prevote_ = value;
+}
+inline void RequestVoteReply::set_prevote(bool value) {
+  _internal_set_prevote(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.RequestVoteReply.PreVote)
+}
+
 // -------------------------------------------------------------------
 
 // InstallSnapshotRequest
 
 // int32 LeaderId = 1;
 inline void InstallSnapshotRequest::clear_leaderid() {
-  leaderid_ = 0;
+  _impl_.leaderid_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_leaderid() const {
-  return leaderid_;
+inline int32_t InstallSnapshotRequest::_internal_leaderid() const {
+  return _impl_.leaderid_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::leaderid() const {
+inline int32_t InstallSnapshotRequest::leaderid() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.InstallSnapshotRequest.LeaderId)
   return _internal_leaderid();
 }
-inline void InstallSnapshotRequest::_internal_set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::_internal_set_leaderid(int32_t value) {
   
-  leaderid_ = value;
+  _impl_.leaderid_ = value;
 }
-inline void InstallSnapshotRequest::set_leaderid(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::set_leaderid(int32_t value) {
   _internal_set_leaderid(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.InstallSnapshotRequest.LeaderId)
 }
 
 // int32 Term = 2;
 inline void InstallSnapshotRequest::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_term() const {
-  return term_;
+inline int32_t InstallSnapshotRequest::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::term() const {
+inline int32_t InstallSnapshotRequest::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.InstallSnapshotRequest.Term)
   return _internal_term();
 }
-inline void InstallSnapshotRequest::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::_internal_set_term(int32_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
 }
-inline void InstallSnapshotRequest::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.InstallSnapshotRequest.Term)
 }
 
 // int32 LastSnapShotIncludeIndex = 3;
 inline void InstallSnapshotRequest::clear_lastsnapshotincludeindex() {
-  lastsnapshotincludeindex_ = 0;
+  _impl_.lastsnapshotincludeindex_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_lastsnapshotincludeindex() const {
-  return lastsnapshotincludeindex_;
+inline int32_t InstallSnapshotRequest::_internal_lastsnapshotincludeindex() const {
+  return _impl_.lastsnapshotincludeindex_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::lastsnapshotincludeindex() const {
+inline int32_t InstallSnapshotRequest::lastsnapshotincludeindex() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.InstallSnapshotRequest.LastSnapShotIncludeIndex)
   return _internal_lastsnapshotincludeindex();
 }
-inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeindex(int32_t value) {
   
-  lastsnapshotincludeindex_ = value;
+  _impl_.lastsnapshotincludeindex_ = value;
 }
-inline void InstallSnapshotRequest::set_lastsnapshotincludeindex(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::set_lastsnapshotincludeindex(int32_t value) {
   _internal_set_lastsnapshotincludeindex(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.InstallSnapshotRequest.LastSnapShotIncludeIndex)
 }
 
 // int32 LastSnapShotIncludeTerm = 4;
 inline void InstallSnapshotRequest::clear_lastsnapshotincludeterm() {
-  lastsnapshotincludeterm_ = 0;
+  _impl_.lastsnapshotincludeterm_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::_internal_lastsnapshotincludeterm() const {
-  return lastsnapshotincludeterm_;
+inline int32_t InstallSnapshotRequest::_internal_lastsnapshotincludeterm() const {
+  return _impl_.lastsnapshotincludeterm_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotRequest::lastsnapshotincludeterm() const {
+inline int32_t InstallSnapshotRequest::lastsnapshotincludeterm() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.InstallSnapshotRequest.LastSnapShotIncludeTerm)
   return _internal_lastsnapshotincludeterm();
 }
-inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::_internal_set_lastsnapshotincludeterm(int32_t value) {
   
-  lastsnapshotincludeterm_ = value;
+  _impl_.lastsnapshotincludeterm_ = value;
 }
-inline void InstallSnapshotRequest::set_lastsnapshotincludeterm(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotRequest::set_lastsnapshotincludeterm(int32_t value) {
   _internal_set_lastsnapshotincludeterm(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.InstallSnapshotRequest.LastSnapShotIncludeTerm)
 }
 
 // bytes Data = 5;
 inline void InstallSnapshotRequest::clear_data() {
-  data_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.data_.ClearToEmpty();
 }
 inline const std::string& InstallSnapshotRequest::data() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.InstallSnapshotRequest.Data)
   return _internal_data();
 }
-inline void InstallSnapshotRequest::set_data(const std::string& value) {
-  _internal_set_data(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InstallSnapshotRequest::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:raftRpcProto.InstallSnapshotRequest.Data)
 }
 inline std::string* InstallSnapshotRequest::mutable_data() {
+  std::string* _s = _internal_mutable_data();
   // @@protoc_insertion_point(field_mutable:raftRpcProto.InstallSnapshotRequest.Data)
-  return _internal_mutable_data();
+  return _s;
 }
 inline const std::string& InstallSnapshotRequest::_internal_data() const {
-  return data_.Get();
+  return _impl_.data_.Get();
 }
 inline void InstallSnapshotRequest::_internal_set_data(const std::string& value) {
   
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void InstallSnapshotRequest::set_data(std::string&& value) {
-  
-  data_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:raftRpcProto.InstallSnapshotRequest.Data)
-}
-inline void InstallSnapshotRequest::set_data(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:raftRpcProto.InstallSnapshotRequest.Data)
-}
-inline void InstallSnapshotRequest::set_data(const void* value,
-    size_t size) {
-  
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:raftRpcProto.InstallSnapshotRequest.Data)
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
 inline std::string* InstallSnapshotRequest::_internal_mutable_data() {
   
-  return data_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
 inline std::string* InstallSnapshotRequest::release_data() {
   // @@protoc_insertion_point(field_release:raftRpcProto.InstallSnapshotRequest.Data)
-  return data_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.data_.Release();
 }
 inline void InstallSnapshotRequest::set_allocated_data(std::string* data) {
   if (data != nullptr) {
@@ -2021,28 +4503,163 @@ inline void InstallSnapshotRequest::set_allocated_data(std::string* data) {
   } else {
     
   }
-  data_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data,
-      GetArena());
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:raftRpcProto.InstallSnapshotRequest.Data)
 }
-inline std::string* InstallSnapshotRequest::unsafe_arena_release_data() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:raftRpcProto.InstallSnapshotRequest.Data)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+
+// int64 Offset = 6;
+inline void InstallSnapshotRequest::clear_offset() {
+  _impl_.offset_ = int64_t{0};
+}
+inline int64_t InstallSnapshotRequest::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int64_t InstallSnapshotRequest::offset() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.InstallSnapshotRequest.Offset)
+  return _internal_offset();
+}
+inline void InstallSnapshotRequest::_internal_set_offset(int64_t value) {
   
-  return data_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  _impl_.offset_ = value;
 }
-inline void InstallSnapshotRequest::unsafe_arena_set_allocated_data(
-    std::string* data) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (data != nullptr) {
+inline void InstallSnapshotRequest::set_offset(int64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.InstallSnapshotRequest.Offset)
+}
+
+// bool Done = 7;
+inline void InstallSnapshotRequest::clear_done() {
+  _impl_.done_ = false;
+}
+inline bool InstallSnapshotRequest::_internal_done() const {
+  return _impl_.done_;
+}
+inline bool InstallSnapshotRequest::done() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.InstallSnapshotRequest.Done)
+  return _internal_done();
+}
+inline void InstallSnapshotRequest::_internal_set_done(bool value) {
+  
+  _impl_.done_ = value;
+}
+inline void InstallSnapshotRequest::set_done(bool value) {
+  _internal_set_done(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.InstallSnapshotRequest.Done)
+}
+
+// int32 GroupId = 8;
+inline void InstallSnapshotRequest::clear_groupid() {
+  _impl_.groupid_ = 0;
+}
+inline int32_t InstallSnapshotRequest::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t InstallSnapshotRequest::groupid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.InstallSnapshotRequest.GroupId)
+  return _internal_groupid();
+}
+inline void InstallSnapshotRequest::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void InstallSnapshotRequest::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.InstallSnapshotRequest.GroupId)
+}
+
+// .raftRpcProto.ClusterConfig Config = 9;
+inline bool InstallSnapshotRequest::_internal_has_config() const {
+  return this != internal_default_instance() && _impl_.config_ != nullptr;
+}
+inline bool InstallSnapshotRequest::has_config() const {
+  return _internal_has_config();
+}
+inline void InstallSnapshotRequest::clear_config() {
+  if (GetArenaForAllocation() == nullptr && _impl_.config_ != nullptr) {
+    delete _impl_.config_;
+  }
+  _impl_.config_ = nullptr;
+}
+inline const ::raftRpcProto::ClusterConfig& InstallSnapshotRequest::_internal_config() const {
+  const ::raftRpcProto::ClusterConfig* p = _impl_.config_;
+  return p != nullptr ? *p : reinterpret_cast<const ::raftRpcProto::ClusterConfig&>(
+      ::raftRpcProto::_ClusterConfig_default_instance_);
+}
+inline const ::raftRpcProto::ClusterConfig& InstallSnapshotRequest::config() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.InstallSnapshotRequest.Config)
+  return _internal_config();
+}
+inline void InstallSnapshotRequest::unsafe_arena_set_allocated_config(
+    ::raftRpcProto::ClusterConfig* config) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.config_);
+  }
+  _impl_.config_ = config;
+  if (config) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftRpcProto.InstallSnapshotRequest.Config)
+}
+inline ::raftRpcProto::ClusterConfig* InstallSnapshotRequest::release_config() {
+  
+  ::raftRpcProto::ClusterConfig* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::raftRpcProto::ClusterConfig* InstallSnapshotRequest::unsafe_arena_release_config() {
+  // @@protoc_insertion_point(field_release:raftRpcProto.InstallSnapshotRequest.Config)
+  
+  ::raftRpcProto::ClusterConfig* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
+  return temp;
+}
+inline ::raftRpcProto::ClusterConfig* InstallSnapshotRequest::_internal_mutable_config() {
+  
+  if (_impl_.config_ == nullptr) {
+    auto* p = CreateMaybeMessage<::raftRpcProto::ClusterConfig>(GetArenaForAllocation());
+    _impl_.config_ = p;
+  }
+  return _impl_.config_;
+}
+inline ::raftRpcProto::ClusterConfig* InstallSnapshotRequest::mutable_config() {
+  ::raftRpcProto::ClusterConfig* _msg = _internal_mutable_config();
+  // @@protoc_insertion_point(field_mutable:raftRpcProto.InstallSnapshotRequest.Config)
+  return _msg;
+}
+inline void InstallSnapshotRequest::set_allocated_config(::raftRpcProto::ClusterConfig* config) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.config_;
+  }
+  if (config) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(config);
+    if (message_arena != submessage_arena) {
+      config = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, config, submessage_arena);
+    }
     
   } else {
     
   }
-  data_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      data, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:raftRpcProto.InstallSnapshotRequest.Data)
+  _impl_.config_ = config;
+  // @@protoc_insertion_point(field_set_allocated:raftRpcProto.InstallSnapshotRequest.Config)
 }
 
 // -------------------------------------------------------------------
@@ -2051,24 +4668,388 @@ inline void InstallSnapshotRequest::unsafe_arena_set_allocated_data(
 
 // int32 Term = 1;
 inline void InstallSnapshotResponse::clear_term() {
-  term_ = 0;
+  _impl_.term_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotResponse::_internal_term() const {
-  return term_;
+inline int32_t InstallSnapshotResponse::_internal_term() const {
+  return _impl_.term_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 InstallSnapshotResponse::term() const {
+inline int32_t InstallSnapshotResponse::term() const {
   // @@protoc_insertion_point(field_get:raftRpcProto.InstallSnapshotResponse.Term)
   return _internal_term();
 }
-inline void InstallSnapshotResponse::_internal_set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotResponse::_internal_set_term(int32_t value) {
   
-  term_ = value;
+  _impl_.term_ = value;
 }
-inline void InstallSnapshotResponse::set_term(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void InstallSnapshotResponse::set_term(int32_t value) {
   _internal_set_term(value);
   // @@protoc_insertion_point(field_set:raftRpcProto.InstallSnapshotResponse.Term)
 }
 
+// int64 Offset = 2;
+inline void InstallSnapshotResponse::clear_offset() {
+  _impl_.offset_ = int64_t{0};
+}
+inline int64_t InstallSnapshotResponse::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int64_t InstallSnapshotResponse::offset() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.InstallSnapshotResponse.Offset)
+  return _internal_offset();
+}
+inline void InstallSnapshotResponse::_internal_set_offset(int64_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void InstallSnapshotResponse::set_offset(int64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.InstallSnapshotResponse.Offset)
+}
+
+// bool Installed = 3;
+inline void InstallSnapshotResponse::clear_installed() {
+  _impl_.installed_ = false;
+}
+inline bool InstallSnapshotResponse::_internal_installed() const {
+  return _impl_.installed_;
+}
+inline bool InstallSnapshotResponse::installed() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.InstallSnapshotResponse.Installed)
+  return _internal_installed();
+}
+inline void InstallSnapshotResponse::_internal_set_installed(bool value) {
+  
+  _impl_.installed_ = value;
+}
+inline void InstallSnapshotResponse::set_installed(bool value) {
+  _internal_set_installed(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.InstallSnapshotResponse.Installed)
+}
+
+// -------------------------------------------------------------------
+
+// ReadIndexArgs
+
+// int32 Term = 1;
+inline void ReadIndexArgs::clear_term() {
+  _impl_.term_ = 0;
+}
+inline int32_t ReadIndexArgs::_internal_term() const {
+  return _impl_.term_;
+}
+inline int32_t ReadIndexArgs::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ReadIndexArgs.Term)
+  return _internal_term();
+}
+inline void ReadIndexArgs::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void ReadIndexArgs::set_term(int32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.ReadIndexArgs.Term)
+}
+
+// int32 FollowerId = 2;
+inline void ReadIndexArgs::clear_followerid() {
+  _impl_.followerid_ = 0;
+}
+inline int32_t ReadIndexArgs::_internal_followerid() const {
+  return _impl_.followerid_;
+}
+inline int32_t ReadIndexArgs::followerid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ReadIndexArgs.FollowerId)
+  return _internal_followerid();
+}
+inline void ReadIndexArgs::_internal_set_followerid(int32_t value) {
+  
+  _impl_.followerid_ = value;
+}
+inline void ReadIndexArgs::set_followerid(int32_t value) {
+  _internal_set_followerid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.ReadIndexArgs.FollowerId)
+}
+
+// int32 GroupId = 3;
+inline void ReadIndexArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
+}
+inline int32_t ReadIndexArgs::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t ReadIndexArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ReadIndexArgs.GroupId)
+  return _internal_groupid();
+}
+inline void ReadIndexArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void ReadIndexArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.ReadIndexArgs.GroupId)
+}
+
+// -------------------------------------------------------------------
+
+// ReadIndexReply
+
+// int32 Term = 1;
+inline void ReadIndexReply::clear_term() {
+  _impl_.term_ = 0;
+}
+inline int32_t ReadIndexReply::_internal_term() const {
+  return _impl_.term_;
+}
+inline int32_t ReadIndexReply::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ReadIndexReply.Term)
+  return _internal_term();
+}
+inline void ReadIndexReply::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void ReadIndexReply::set_term(int32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.ReadIndexReply.Term)
+}
+
+// bool Success = 2;
+inline void ReadIndexReply::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool ReadIndexReply::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool ReadIndexReply::success() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ReadIndexReply.Success)
+  return _internal_success();
+}
+inline void ReadIndexReply::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void ReadIndexReply::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.ReadIndexReply.Success)
+}
+
+// int32 ReadIndex = 3;
+inline void ReadIndexReply::clear_readindex() {
+  _impl_.readindex_ = 0;
+}
+inline int32_t ReadIndexReply::_internal_readindex() const {
+  return _impl_.readindex_;
+}
+inline int32_t ReadIndexReply::readindex() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.ReadIndexReply.ReadIndex)
+  return _internal_readindex();
+}
+inline void ReadIndexReply::_internal_set_readindex(int32_t value) {
+  
+  _impl_.readindex_ = value;
+}
+inline void ReadIndexReply::set_readindex(int32_t value) {
+  _internal_set_readindex(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.ReadIndexReply.ReadIndex)
+}
+
+// -------------------------------------------------------------------
+
+// TimeoutNowArgs
+
+// int32 Term = 1;
+inline void TimeoutNowArgs::clear_term() {
+  _impl_.term_ = 0;
+}
+inline int32_t TimeoutNowArgs::_internal_term() const {
+  return _impl_.term_;
+}
+inline int32_t TimeoutNowArgs::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.TimeoutNowArgs.Term)
+  return _internal_term();
+}
+inline void TimeoutNowArgs::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void TimeoutNowArgs::set_term(int32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.TimeoutNowArgs.Term)
+}
+
+// int32 LeaderId = 2;
+inline void TimeoutNowArgs::clear_leaderid() {
+  _impl_.leaderid_ = 0;
+}
+inline int32_t TimeoutNowArgs::_internal_leaderid() const {
+  return _impl_.leaderid_;
+}
+inline int32_t TimeoutNowArgs::leaderid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.TimeoutNowArgs.LeaderId)
+  return _internal_leaderid();
+}
+inline void TimeoutNowArgs::_internal_set_leaderid(int32_t value) {
+  
+  _impl_.leaderid_ = value;
+}
+inline void TimeoutNowArgs::set_leaderid(int32_t value) {
+  _internal_set_leaderid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.TimeoutNowArgs.LeaderId)
+}
+
+// int32 GroupId = 3;
+inline void TimeoutNowArgs::clear_groupid() {
+  _impl_.groupid_ = 0;
+}
+inline int32_t TimeoutNowArgs::_internal_groupid() const {
+  return _impl_.groupid_;
+}
+inline int32_t TimeoutNowArgs::groupid() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.TimeoutNowArgs.GroupId)
+  return _internal_groupid();
+}
+inline void TimeoutNowArgs::_internal_set_groupid(int32_t value) {
+  
+  _impl_.groupid_ = value;
+}
+inline void TimeoutNowArgs::set_groupid(int32_t value) {
+  _internal_set_groupid(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.TimeoutNowArgs.GroupId)
+}
+
+// -------------------------------------------------------------------
+
+// TimeoutNowReply
+
+// int32 Term = 1;
+inline void TimeoutNowReply::clear_term() {
+  _impl_.term_ = 0;
+}
+inline int32_t TimeoutNowReply::_internal_term() const {
+  return _impl_.term_;
+}
+inline int32_t TimeoutNowReply::term() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.TimeoutNowReply.Term)
+  return _internal_term();
+}
+inline void TimeoutNowReply::_internal_set_term(int32_t value) {
+  
+  _impl_.term_ = value;
+}
+inline void TimeoutNowReply::set_term(int32_t value) {
+  _internal_set_term(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.TimeoutNowReply.Term)
+}
+
+// bool Success = 2;
+inline void TimeoutNowReply::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool TimeoutNowReply::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool TimeoutNowReply::success() const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.TimeoutNowReply.Success)
+  return _internal_success();
+}
+inline void TimeoutNowReply::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void TimeoutNowReply::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:raftRpcProto.TimeoutNowReply.Success)
+}
+
+// -------------------------------------------------------------------
+
+// BatchAppendEntriesArgs
+
+// repeated .raftRpcProto.AppendEntriesArgs Args = 1;
+inline int BatchAppendEntriesArgs::_internal_args_size() const {
+  return _impl_.args_.size();
+}
+inline int BatchAppendEntriesArgs::args_size() const {
+  return _internal_args_size();
+}
+inline void BatchAppendEntriesArgs::clear_args() {
+  _impl_.args_.Clear();
+}
+inline ::raftRpcProto::AppendEntriesArgs* BatchAppendEntriesArgs::mutable_args(int index) {
+  // @@protoc_insertion_point(field_mutable:raftRpcProto.BatchAppendEntriesArgs.Args)
+  return _impl_.args_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::AppendEntriesArgs >*
+BatchAppendEntriesArgs::mutable_args() {
+  // @@protoc_insertion_point(field_mutable_list:raftRpcProto.BatchAppendEntriesArgs.Args)
+  return &_impl_.args_;
+}
+inline const ::raftRpcProto::AppendEntriesArgs& BatchAppendEntriesArgs::_internal_args(int index) const {
+  return _impl_.args_.Get(index);
+}
+inline const ::raftRpcProto::AppendEntriesArgs& BatchAppendEntriesArgs::args(int index) const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.BatchAppendEntriesArgs.Args)
+  return _internal_args(index);
+}
+inline ::raftRpcProto::AppendEntriesArgs* BatchAppendEntriesArgs::_internal_add_args() {
+  return _impl_.args_.Add();
+}
+inline ::raftRpcProto::AppendEntriesArgs* BatchAppendEntriesArgs::add_args() {
+  ::raftRpcProto::AppendEntriesArgs* _add = _internal_add_args();
+  // @@protoc_insertion_point(field_add:raftRpcProto.BatchAppendEntriesArgs.Args)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::AppendEntriesArgs >&
+BatchAppendEntriesArgs::args() const {
+  // @@protoc_insertion_point(field_list:raftRpcProto.BatchAppendEntriesArgs.Args)
+  return _impl_.args_;
+}
+
+// -------------------------------------------------------------------
+
+// BatchAppendEntriesReply
+
+// repeated .raftRpcProto.AppendEntriesReply Replies = 1;
+inline int BatchAppendEntriesReply::_internal_replies_size() const {
+  return _impl_.replies_.size();
+}
+inline int BatchAppendEntriesReply::replies_size() const {
+  return _internal_replies_size();
+}
+inline void BatchAppendEntriesReply::clear_replies() {
+  _impl_.replies_.Clear();
+}
+inline ::raftRpcProto::AppendEntriesReply* BatchAppendEntriesReply::mutable_replies(int index) {
+  // @@protoc_insertion_point(field_mutable:raftRpcProto.BatchAppendEntriesReply.Replies)
+  return _impl_.replies_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::AppendEntriesReply >*
+BatchAppendEntriesReply::mutable_replies() {
+  // @@protoc_insertion_point(field_mutable_list:raftRpcProto.BatchAppendEntriesReply.Replies)
+  return &_impl_.replies_;
+}
+inline const ::raftRpcProto::AppendEntriesReply& BatchAppendEntriesReply::_internal_replies(int index) const {
+  return _impl_.replies_.Get(index);
+}
+inline const ::raftRpcProto::AppendEntriesReply& BatchAppendEntriesReply::replies(int index) const {
+  // @@protoc_insertion_point(field_get:raftRpcProto.BatchAppendEntriesReply.Replies)
+  return _internal_replies(index);
+}
+inline ::raftRpcProto::AppendEntriesReply* BatchAppendEntriesReply::_internal_add_replies() {
+  return _impl_.replies_.Add();
+}
+inline ::raftRpcProto::AppendEntriesReply* BatchAppendEntriesReply::add_replies() {
+  ::raftRpcProto::AppendEntriesReply* _add = _internal_add_replies();
+  // @@protoc_insertion_point(field_add:raftRpcProto.BatchAppendEntriesReply.Replies)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::raftRpcProto::AppendEntriesReply >&
+BatchAppendEntriesReply::replies() const {
+  // @@protoc_insertion_point(field_list:raftRpcProto.BatchAppendEntriesReply.Replies)
+  return _impl_.replies_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -2084,11 +5065,44 @@ inline void InstallSnapshotResponse::set_term(::PROTOBUF_NAMESPACE_ID::int32 val
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace raftRpcProto
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::raftRpcProto::EntryType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::raftRpcProto::EntryType>() {
+  return ::raftRpcProto::EntryType_descriptor();
+}
+template <> struct is_proto_enum< ::raftRpcProto::ConfChangeType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::raftRpcProto::ConfChangeType>() {
+  return ::raftRpcProto::ConfChangeType_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
@@ -14,426 +14,772 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_raftRPC_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_LogEntry_raftRPC_2eproto;
-namespace raftRpcProto {
-class LogEntryDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<LogEntry> _instance;
-} _LogEntry_default_instance_;
-class AppendEntriesArgsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AppendEntriesArgs> _instance;
-} _AppendEntriesArgs_default_instance_;
-class AppendEntriesReplyDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AppendEntriesReply> _instance;
-} _AppendEntriesReply_default_instance_;
-class RequestVoteArgsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RequestVoteArgs> _instance;
-} _RequestVoteArgs_default_instance_;
-class RequestVoteReplyDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RequestVoteReply> _instance;
-} _RequestVoteReply_default_instance_;
-class InstallSnapshotRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<InstallSnapshotRequest> _instance;
-} _InstallSnapshotRequest_default_instance_;
-class InstallSnapshotResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<InstallSnapshotResponse> _instance;
-} _InstallSnapshotResponse_default_instance_;
-}  // namespace raftRpcProto
-static void InitDefaultsscc_info_AppendEntriesArgs_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProto::_AppendEntriesArgs_default_instance_;
-    new (ptr) ::raftRpcProto::AppendEntriesArgs();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftRpcProto::AppendEntriesArgs::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_AppendEntriesArgs_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_AppendEntriesArgs_raftRPC_2eproto}, {
-      &scc_info_LogEntry_raftRPC_2eproto.base,}};
-
-static void InitDefaultsscc_info_AppendEntriesReply_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProto::_AppendEntriesReply_default_instance_;
-    new (ptr) ::raftRpcProto::AppendEntriesReply();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftRpcProto::AppendEntriesReply::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppendEntriesReply_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_AppendEntriesReply_raftRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_InstallSnapshotRequest_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProto::_InstallSnapshotRequest_default_instance_;
-    new (ptr) ::raftRpcProto::InstallSnapshotRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftRpcProto::InstallSnapshotRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_InstallSnapshotRequest_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_InstallSnapshotRequest_raftRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_InstallSnapshotResponse_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProto::_InstallSnapshotResponse_default_instance_;
-    new (ptr) ::raftRpcProto::InstallSnapshotResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftRpcProto::InstallSnapshotResponse::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_InstallSnapshotResponse_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_InstallSnapshotResponse_raftRPC_2eproto}, {}};
 
-static void InitDefaultsscc_info_LogEntry_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+PROTOBUF_PRAGMA_INIT_SEG
 
-  {
-    void* ptr = &::raftRpcProto::_LogEntry_default_instance_;
-    new (ptr) ::raftRpcProto::LogEntry();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftRpcProto::LogEntry::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_LogEntry_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_LogEntry_raftRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_RequestVoteArgs_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProto::_RequestVoteArgs_default_instance_;
-    new (ptr) ::raftRpcProto::RequestVoteArgs();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftRpcProto::RequestVoteArgs::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RequestVoteArgs_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RequestVoteArgs_raftRPC_2eproto}, {}};
-
-static void InitDefaultsscc_info_RequestVoteReply_raftRPC_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::raftRpcProto::_RequestVoteReply_default_instance_;
-    new (ptr) ::raftRpcProto::RequestVoteReply();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::raftRpcProto::RequestVoteReply::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RequestVoteReply_raftRPC_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RequestVoteReply_raftRPC_2eproto}, {}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_raftRPC_2eproto[7];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_raftRPC_2eproto = nullptr;
-static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* file_level_service_descriptors_raftRPC_2eproto[1];
+namespace raftRpcProto {
+PROTOBUF_CONSTEXPR LogEntry::LogEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.command_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.logterm_)*/0
+  , /*decltype(_impl_.logindex_)*/0
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LogEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LogEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LogEntryDefaultTypeInternal() {}
+  union {
+    LogEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LogEntryDefaultTypeInternal _LogEntry_default_instance_;
+PROTOBUF_CONSTEXPR PeerAddr::PeerAddr(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ip_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.nodeid_)*/0
+  , /*decltype(_impl_.port_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PeerAddrDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PeerAddrDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PeerAddrDefaultTypeInternal() {}
+  union {
+    PeerAddr _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PeerAddrDefaultTypeInternal _PeerAddr_default_instance_;
+PROTOBUF_CONSTEXPR ConfChange::ConfChange(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.voters_)*/{}
+  , /*decltype(_impl_._voters_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.addrs_)*/{}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.nodeid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ConfChangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConfChangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConfChangeDefaultTypeInternal() {}
+  union {
+    ConfChange _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfChangeDefaultTypeInternal _ConfChange_default_instance_;
+PROTOBUF_CONSTEXPR ClusterConfig::ClusterConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.voters_)*/{}
+  , /*decltype(_impl_._voters_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.learners_)*/{}
+  , /*decltype(_impl_._learners_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.outgoingvoters_)*/{}
+  , /*decltype(_impl_._outgoingvoters_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.addrs_)*/{}
+  , /*decltype(_impl_.witnesses_)*/{}
+  , /*decltype(_impl_._witnesses_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ClusterConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClusterConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClusterConfigDefaultTypeInternal() {}
+  union {
+    ClusterConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClusterConfigDefaultTypeInternal _ClusterConfig_default_instance_;
+PROTOBUF_CONSTEXPR AppendEntriesArgs::AppendEntriesArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.prevlogindex_)*/0
+  , /*decltype(_impl_.prevlogterm_)*/0
+  , /*decltype(_impl_.leadercommit_)*/0
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AppendEntriesArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AppendEntriesArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AppendEntriesArgsDefaultTypeInternal() {}
+  union {
+    AppendEntriesArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AppendEntriesArgsDefaultTypeInternal _AppendEntriesArgs_default_instance_;
+PROTOBUF_CONSTEXPR AppendEntriesReply::AppendEntriesReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.updatenextindex_)*/0
+  , /*decltype(_impl_.appstate_)*/0
+  , /*decltype(_impl_.conflictterm_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AppendEntriesReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AppendEntriesReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AppendEntriesReplyDefaultTypeInternal() {}
+  union {
+    AppendEntriesReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AppendEntriesReplyDefaultTypeInternal _AppendEntriesReply_default_instance_;
+PROTOBUF_CONSTEXPR RequestVoteArgs::RequestVoteArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.candidateid_)*/0
+  , /*decltype(_impl_.lastlogindex_)*/0
+  , /*decltype(_impl_.lastlogterm_)*/0
+  , /*decltype(_impl_.prevote_)*/false
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RequestVoteArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestVoteArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestVoteArgsDefaultTypeInternal() {}
+  union {
+    RequestVoteArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestVoteArgsDefaultTypeInternal _RequestVoteArgs_default_instance_;
+PROTOBUF_CONSTEXPR RequestVoteReply::RequestVoteReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.votestate_)*/0
+  , /*decltype(_impl_.votegranted_)*/false
+  , /*decltype(_impl_.prevote_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RequestVoteReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestVoteReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestVoteReplyDefaultTypeInternal() {}
+  union {
+    RequestVoteReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestVoteReplyDefaultTypeInternal _RequestVoteReply_default_instance_;
+PROTOBUF_CONSTEXPR InstallSnapshotRequest::InstallSnapshotRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.config_)*/nullptr
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.lastsnapshotincludeindex_)*/0
+  , /*decltype(_impl_.lastsnapshotincludeterm_)*/0
+  , /*decltype(_impl_.offset_)*/int64_t{0}
+  , /*decltype(_impl_.done_)*/false
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InstallSnapshotRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InstallSnapshotRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InstallSnapshotRequestDefaultTypeInternal() {}
+  union {
+    InstallSnapshotRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InstallSnapshotRequestDefaultTypeInternal _InstallSnapshotRequest_default_instance_;
+PROTOBUF_CONSTEXPR InstallSnapshotResponse::InstallSnapshotResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.offset_)*/int64_t{0}
+  , /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.installed_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InstallSnapshotResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InstallSnapshotResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InstallSnapshotResponseDefaultTypeInternal() {}
+  union {
+    InstallSnapshotResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InstallSnapshotResponseDefaultTypeInternal _InstallSnapshotResponse_default_instance_;
+PROTOBUF_CONSTEXPR ReadIndexArgs::ReadIndexArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.followerid_)*/0
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReadIndexArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadIndexArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadIndexArgsDefaultTypeInternal() {}
+  union {
+    ReadIndexArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadIndexArgsDefaultTypeInternal _ReadIndexArgs_default_instance_;
+PROTOBUF_CONSTEXPR ReadIndexReply::ReadIndexReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.readindex_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReadIndexReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReadIndexReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReadIndexReplyDefaultTypeInternal() {}
+  union {
+    ReadIndexReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReadIndexReplyDefaultTypeInternal _ReadIndexReply_default_instance_;
+PROTOBUF_CONSTEXPR TimeoutNowArgs::TimeoutNowArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.leaderid_)*/0
+  , /*decltype(_impl_.groupid_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TimeoutNowArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TimeoutNowArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TimeoutNowArgsDefaultTypeInternal() {}
+  union {
+    TimeoutNowArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TimeoutNowArgsDefaultTypeInternal _TimeoutNowArgs_default_instance_;
+PROTOBUF_CONSTEXPR TimeoutNowReply::TimeoutNowReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.term_)*/0
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TimeoutNowReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TimeoutNowReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TimeoutNowReplyDefaultTypeInternal() {}
+  union {
+    TimeoutNowReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TimeoutNowReplyDefaultTypeInternal _TimeoutNowReply_default_instance_;
+PROTOBUF_CONSTEXPR BatchAppendEntriesArgs::BatchAppendEntriesArgs(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.args_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchAppendEntriesArgsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchAppendEntriesArgsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchAppendEntriesArgsDefaultTypeInternal() {}
+  union {
+    BatchAppendEntriesArgs _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchAppendEntriesArgsDefaultTypeInternal _BatchAppendEntriesArgs_default_instance_;
+PROTOBUF_CONSTEXPR BatchAppendEntriesReply::BatchAppendEntriesReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.replies_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchAppendEntriesReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchAppendEntriesReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchAppendEntriesReplyDefaultTypeInternal() {}
+  union {
+    BatchAppendEntriesReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchAppendEntriesReplyDefaultTypeInternal _BatchAppendEntriesReply_default_instance_;
+}  // namespace raftRpcProto
+static ::_pb::Metadata file_level_metadata_raftRPC_2eproto[16];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_raftRPC_2eproto[2];
+static const ::_pb::ServiceDescriptor* file_level_service_descriptors_raftRPC_2eproto[1];
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_raftRPC_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_raftRPC_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProto::LogEntry, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::LogEntry, command_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::LogEntry, logterm_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::LogEntry, logindex_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::LogEntry, _impl_.command_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::LogEntry, _impl_.logterm_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::LogEntry, _impl_.logindex_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::LogEntry, _impl_.type_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::PeerAddr, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::PeerAddr, _impl_.nodeid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::PeerAddr, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::PeerAddr, _impl_.port_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ConfChange, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ConfChange, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ConfChange, _impl_.nodeid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ConfChange, _impl_.voters_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ConfChange, _impl_.addrs_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ClusterConfig, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ClusterConfig, _impl_.voters_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ClusterConfig, _impl_.learners_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ClusterConfig, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ClusterConfig, _impl_.outgoingvoters_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ClusterConfig, _impl_.addrs_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ClusterConfig, _impl_.witnesses_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesArgs, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesArgs, term_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesArgs, leaderid_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesArgs, prevlogindex_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesArgs, prevlogterm_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesArgs, entries_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesArgs, leadercommit_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesArgs, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesArgs, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesArgs, _impl_.prevlogindex_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesArgs, _impl_.prevlogterm_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesArgs, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesArgs, _impl_.leadercommit_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesArgs, _impl_.groupid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesReply, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesReply, term_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesReply, success_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesReply, updatenextindex_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesReply, appstate_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesReply, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesReply, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesReply, _impl_.updatenextindex_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesReply, _impl_.appstate_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::AppendEntriesReply, _impl_.conflictterm_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteArgs, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteArgs, term_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteArgs, candidateid_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteArgs, lastlogindex_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteArgs, lastlogterm_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteArgs, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteArgs, _impl_.candidateid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteArgs, _impl_.lastlogindex_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteArgs, _impl_.lastlogterm_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteArgs, _impl_.prevote_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteArgs, _impl_.groupid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteReply, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteReply, term_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteReply, votegranted_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteReply, votestate_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteReply, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteReply, _impl_.votegranted_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteReply, _impl_.votestate_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::RequestVoteReply, _impl_.prevote_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotRequest, leaderid_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotRequest, term_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotRequest, lastsnapshotincludeindex_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotRequest, lastsnapshotincludeterm_),
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotRequest, data_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotRequest, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotRequest, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotRequest, _impl_.lastsnapshotincludeindex_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotRequest, _impl_.lastsnapshotincludeterm_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotRequest, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotRequest, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotRequest, _impl_.done_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotRequest, _impl_.groupid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotRequest, _impl_.config_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotResponse, term_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotResponse, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotResponse, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::InstallSnapshotResponse, _impl_.installed_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ReadIndexArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ReadIndexArgs, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ReadIndexArgs, _impl_.followerid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ReadIndexArgs, _impl_.groupid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ReadIndexReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ReadIndexReply, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ReadIndexReply, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::ReadIndexReply, _impl_.readindex_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::TimeoutNowArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::TimeoutNowArgs, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::TimeoutNowArgs, _impl_.leaderid_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::TimeoutNowArgs, _impl_.groupid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::TimeoutNowReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::TimeoutNowReply, _impl_.term_),
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::TimeoutNowReply, _impl_.success_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::BatchAppendEntriesArgs, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::BatchAppendEntriesArgs, _impl_.args_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::BatchAppendEntriesReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::raftRpcProto::BatchAppendEntriesReply, _impl_.replies_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::raftRpcProto::LogEntry)},
-  { 8, -1, sizeof(::raftRpcProto::AppendEntriesArgs)},
-  { 19, -1, sizeof(::raftRpcProto::AppendEntriesReply)},
-  { 28, -1, sizeof(::raftRpcProto::RequestVoteArgs)},
-  { 37, -1, sizeof(::raftRpcProto::RequestVoteReply)},
-  { 45, -1, sizeof(::raftRpcProto::InstallSnapshotRequest)},
-  { 55, -1, sizeof(::raftRpcProto::InstallSnapshotResponse)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::raftRpcProto::LogEntry)},
+  { 10, -1, -1, sizeof(::raftRpcProto::PeerAddr)},
+  { 19, -1, -1, sizeof(::raftRpcProto::ConfChange)},
+  { 29, -1, -1, sizeof(::raftRpcProto::ClusterConfig)},
+  { 41, -1, -1, sizeof(::raftRpcProto::AppendEntriesArgs)},
+  { 54, -1, -1, sizeof(::raftRpcProto::AppendEntriesReply)},
+  { 65, -1, -1, sizeof(::raftRpcProto::RequestVoteArgs)},
+  { 77, -1, -1, sizeof(::raftRpcProto::RequestVoteReply)},
+  { 87, -1, -1, sizeof(::raftRpcProto::InstallSnapshotRequest)},
+  { 102, -1, -1, sizeof(::raftRpcProto::InstallSnapshotResponse)},
+  { 111, -1, -1, sizeof(::raftRpcProto::ReadIndexArgs)},
+  { 120, -1, -1, sizeof(::raftRpcProto::ReadIndexReply)},
+  { 129, -1, -1, sizeof(::raftRpcProto::TimeoutNowArgs)},
+  { 138, -1, -1, sizeof(::raftRpcProto::TimeoutNowReply)},
+  { 146, -1, -1, sizeof(::raftRpcProto::BatchAppendEntriesArgs)},
+  { 153, -1, -1, sizeof(::raftRpcProto::BatchAppendEntriesReply)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProto::_LogEntry_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProto::_AppendEntriesArgs_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProto::_AppendEntriesReply_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProto::_RequestVoteArgs_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProto::_RequestVoteReply_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProto::_InstallSnapshotRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::raftRpcProto::_InstallSnapshotResponse_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::raftRpcProto::_LogEntry_default_instance_._instance,
+  &::raftRpcProto::_PeerAddr_default_instance_._instance,
+  &::raftRpcProto::_ConfChange_default_instance_._instance,
+  &::raftRpcProto::_ClusterConfig_default_instance_._instance,
+  &::raftRpcProto::_AppendEntriesArgs_default_instance_._instance,
+  &::raftRpcProto::_AppendEntriesReply_default_instance_._instance,
+  &::raftRpcProto::_RequestVoteArgs_default_instance_._instance,
+  &::raftRpcProto::_RequestVoteReply_default_instance_._instance,
+  &::raftRpcProto::_InstallSnapshotRequest_default_instance_._instance,
+  &::raftRpcProto::_InstallSnapshotResponse_default_instance_._instance,
+  &::raftRpcProto::_ReadIndexArgs_default_instance_._instance,
+  &::raftRpcProto::_ReadIndexReply_default_instance_._instance,
+  &::raftRpcProto::_TimeoutNowArgs_default_instance_._instance,
+  &::raftRpcProto::_TimeoutNowReply_default_instance_._instance,
+  &::raftRpcProto::_BatchAppendEntriesArgs_default_instance_._instance,
+  &::raftRpcProto::_BatchAppendEntriesReply_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_raftRPC_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\rraftRPC.proto\022\014raftRpcProto\">\n\010LogEntr"
+  "\n\rraftRPC.proto\022\014raftRpcProto\"e\n\010LogEntr"
   "y\022\017\n\007Command\030\001 \001(\014\022\017\n\007LogTerm\030\002 \001(\005\022\020\n\010L"
-  "ogIndex\030\003 \001(\005\"\235\001\n\021AppendEntriesArgs\022\014\n\004T"
-  "erm\030\001 \001(\005\022\020\n\010LeaderId\030\002 \001(\005\022\024\n\014PrevLogIn"
-  "dex\030\003 \001(\005\022\023\n\013PrevLogTerm\030\004 \001(\005\022\'\n\007Entrie"
-  "s\030\005 \003(\0132\026.raftRpcProto.LogEntry\022\024\n\014Leade"
-  "rCommit\030\006 \001(\005\"^\n\022AppendEntriesReply\022\014\n\004T"
-  "erm\030\001 \001(\005\022\017\n\007Success\030\002 \001(\010\022\027\n\017UpdateNext"
-  "Index\030\003 \001(\005\022\020\n\010AppState\030\004 \001(\005\"_\n\017Request"
-  "VoteArgs\022\014\n\004Term\030\001 \001(\005\022\023\n\013CandidateId\030\002 "
-  "\001(\005\022\024\n\014LastLogIndex\030\003 \001(\005\022\023\n\013LastLogTerm"
-  "\030\004 \001(\005\"H\n\020RequestVoteReply\022\014\n\004Term\030\001 \001(\005"
-  "\022\023\n\013VoteGranted\030\002 \001(\010\022\021\n\tVoteState\030\003 \001(\005"
-  "\"\211\001\n\026InstallSnapshotRequest\022\020\n\010LeaderId\030"
-  "\001 \001(\005\022\014\n\004Term\030\002 \001(\005\022 \n\030LastSnapShotInclu"
-  "deIndex\030\003 \001(\005\022\037\n\027LastSnapShotIncludeTerm"
-  "\030\004 \001(\005\022\014\n\004Data\030\005 \001(\014\"\'\n\027InstallSnapshotR"
-  "esponse\022\014\n\004Term\030\001 \001(\0052\213\002\n\007raftRpc\022R\n\rApp"
-  "endEntries\022\037.raftRpcProto.AppendEntriesA"
-  "rgs\032 .raftRpcProto.AppendEntriesReply\022^\n"
-  "\017InstallSnapshot\022$.raftRpcProto.InstallS"
-  "napshotRequest\032%.raftRpcProto.InstallSna"
-  "pshotResponse\022L\n\013RequestVote\022\035.raftRpcPr"
-  "oto.RequestVoteArgs\032\036.raftRpcProto.Reque"
-  "stVoteReplyB\003\200\001\001b\006proto3"
+  "ogIndex\030\003 \001(\005\022%\n\004Type\030\004 \001(\0162\027.raftRpcPro"
+  "to.EntryType\"4\n\010PeerAddr\022\016\n\006NodeId\030\001 \001(\005"
+  "\022\n\n\002Ip\030\002 \001(\t\022\014\n\004Port\030\003 \001(\005\"\177\n\nConfChange"
+  "\022*\n\004Type\030\001 \001(\0162\034.raftRpcProto.ConfChange"
+  "Type\022\016\n\006NodeId\030\002 \001(\005\022\016\n\006Voters\030\003 \003(\005\022%\n\005"
+  "Addrs\030\004 \003(\0132\026.raftRpcProto.PeerAddr\"\222\001\n\r"
+  "ClusterConfig\022\016\n\006Voters\030\001 \003(\005\022\020\n\010Learner"
+  "s\030\002 \003(\005\022\r\n\005Index\030\003 \001(\005\022\026\n\016OutgoingVoters"
+  "\030\004 \003(\005\022%\n\005Addrs\030\005 \003(\0132\026.raftRpcProto.Pee"
+  "rAddr\022\021\n\tWitnesses\030\006 \003(\005\"\256\001\n\021AppendEntri"
+  "esArgs\022\014\n\004Term\030\001 \001(\005\022\020\n\010LeaderId\030\002 \001(\005\022\024"
+  "\n\014PrevLogIndex\030\003 \001(\005\022\023\n\013PrevLogTerm\030\004 \001("
+  "\005\022\'\n\007Entries\030\005 \003(\0132\026.raftRpcProto.LogEnt"
+  "ry\022\024\n\014LeaderCommit\030\006 \001(\005\022\017\n\007GroupId\030\007 \001("
+  "\005\"t\n\022AppendEntriesReply\022\014\n\004Term\030\001 \001(\005\022\017\n"
+  "\007Success\030\002 \001(\010\022\027\n\017UpdateNextIndex\030\003 \001(\005\022"
+  "\020\n\010AppState\030\004 \001(\005\022\024\n\014ConflictTerm\030\005 \001(\005\""
+  "\201\001\n\017RequestVoteArgs\022\014\n\004Term\030\001 \001(\005\022\023\n\013Can"
+  "didateId\030\002 \001(\005\022\024\n\014LastLogIndex\030\003 \001(\005\022\023\n\013"
+  "LastLogTerm\030\004 \001(\005\022\017\n\007PreVote\030\005 \001(\010\022\017\n\007Gr"
+  "oupId\030\006 \001(\005\"Y\n\020RequestVoteReply\022\014\n\004Term\030"
+  "\001 \001(\005\022\023\n\013VoteGranted\030\002 \001(\010\022\021\n\tVoteState\030"
+  "\003 \001(\005\022\017\n\007PreVote\030\004 \001(\010\"\345\001\n\026InstallSnapsh"
+  "otRequest\022\020\n\010LeaderId\030\001 \001(\005\022\014\n\004Term\030\002 \001("
+  "\005\022 \n\030LastSnapShotIncludeIndex\030\003 \001(\005\022\037\n\027L"
+  "astSnapShotIncludeTerm\030\004 \001(\005\022\014\n\004Data\030\005 \001"
+  "(\014\022\016\n\006Offset\030\006 \001(\003\022\014\n\004Done\030\007 \001(\010\022\017\n\007Grou"
+  "pId\030\010 \001(\005\022+\n\006Config\030\t \001(\0132\033.raftRpcProto"
+  ".ClusterConfig\"J\n\027InstallSnapshotRespons"
+  "e\022\014\n\004Term\030\001 \001(\005\022\016\n\006Offset\030\002 \001(\003\022\021\n\tInsta"
+  "lled\030\003 \001(\010\"B\n\rReadIndexArgs\022\014\n\004Term\030\001 \001("
+  "\005\022\022\n\nFollowerId\030\002 \001(\005\022\017\n\007GroupId\030\003 \001(\005\"B"
+  "\n\016ReadIndexReply\022\014\n\004Term\030\001 \001(\005\022\017\n\007Succes"
+  "s\030\002 \001(\010\022\021\n\tReadIndex\030\003 \001(\005\"A\n\016TimeoutNow"
+  "Args\022\014\n\004Term\030\001 \001(\005\022\020\n\010LeaderId\030\002 \001(\005\022\017\n\007"
+  "GroupId\030\003 \001(\005\"0\n\017TimeoutNowReply\022\014\n\004Term"
+  "\030\001 \001(\005\022\017\n\007Success\030\002 \001(\010\"G\n\026BatchAppendEn"
+  "triesArgs\022-\n\004Args\030\001 \003(\0132\037.raftRpcProto.A"
+  "ppendEntriesArgs\"L\n\027BatchAppendEntriesRe"
+  "ply\0221\n\007Replies\030\001 \003(\0132 .raftRpcProto.Appe"
+  "ndEntriesReply*1\n\tEntryType\022\017\n\013EntryNorm"
+  "al\020\000\022\023\n\017EntryConfChange\020\001*\217\001\n\016ConfChange"
+  "Type\022\022\n\016ConfAddLearner\020\000\022\026\n\022ConfPromoteL"
+  "earner\020\001\022\025\n\021ConfRemoveLearner\020\002\022\022\n\016ConfE"
+  "nterJoint\020\003\022\022\n\016ConfLeaveJoint\020\004\022\022\n\016ConfA"
+  "ddWitness\020\0052\201\004\n\007raftRpc\022R\n\rAppendEntries"
+  "\022\037.raftRpcProto.AppendEntriesArgs\032 .raft"
+  "RpcProto.AppendEntriesReply\022^\n\017InstallSn"
+  "apshot\022$.raftRpcProto.InstallSnapshotReq"
+  "uest\032%.raftRpcProto.InstallSnapshotRespo"
+  "nse\022L\n\013RequestVote\022\035.raftRpcProto.Reques"
+  "tVoteArgs\032\036.raftRpcProto.RequestVoteRepl"
+  "y\022F\n\tReadIndex\022\033.raftRpcProto.ReadIndexA"
+  "rgs\032\034.raftRpcProto.ReadIndexReply\022I\n\nTim"
+  "eoutNow\022\034.raftRpcProto.TimeoutNowArgs\032\035."
+  "raftRpcProto.TimeoutNowReply\022a\n\022BatchApp"
+  "endEntries\022$.raftRpcProto.BatchAppendEnt"
+  "riesArgs\032%.raftRpcProto.BatchAppendEntri"
+  "esReplyB\003\200\001\001b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_raftRPC_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_raftRPC_2eproto_sccs[7] = {
-  &scc_info_AppendEntriesArgs_raftRPC_2eproto.base,
-  &scc_info_AppendEntriesReply_raftRPC_2eproto.base,
-  &scc_info_InstallSnapshotRequest_raftRPC_2eproto.base,
-  &scc_info_InstallSnapshotResponse_raftRPC_2eproto.base,
-  &scc_info_LogEntry_raftRPC_2eproto.base,
-  &scc_info_RequestVoteArgs_raftRPC_2eproto.base,
-  &scc_info_RequestVoteReply_raftRPC_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_raftRPC_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_raftRPC_2eproto = {
-  false, false, descriptor_table_protodef_raftRPC_2eproto, "raftRPC.proto", 984,
-  &descriptor_table_raftRPC_2eproto_once, descriptor_table_raftRPC_2eproto_sccs, descriptor_table_raftRPC_2eproto_deps, 7, 0,
-  schemas, file_default_instances, TableStruct_raftRPC_2eproto::offsets,
-  file_level_metadata_raftRPC_2eproto, 7, file_level_enum_descriptors_raftRPC_2eproto, file_level_service_descriptors_raftRPC_2eproto,
+static ::_pbi::once_flag descriptor_table_raftRPC_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_raftRPC_2eproto = {
+    false, false, 2420, descriptor_table_protodef_raftRPC_2eproto,
+    "raftRPC.proto",
+    &descriptor_table_raftRPC_2eproto_once, nullptr, 0, 16,
+    schemas, file_default_instances, TableStruct_raftRPC_2eproto::offsets,
+    file_level_metadata_raftRPC_2eproto, file_level_enum_descriptors_raftRPC_2eproto,
+    file_level_service_descriptors_raftRPC_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_raftRPC_2eproto_getter() {
+  return &descriptor_table_raftRPC_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_raftRPC_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_raftRPC_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_raftRPC_2eproto(&descriptor_table_raftRPC_2eproto);
 namespace raftRpcProto {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* EntryType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_raftRPC_2eproto);
+  return file_level_enum_descriptors_raftRPC_2eproto[0];
+}
+bool EntryType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ConfChangeType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_raftRPC_2eproto);
+  return file_level_enum_descriptors_raftRPC_2eproto[1];
+}
+bool ConfChangeType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
-void LogEntry::InitAsDefaultInstance() {
-}
 class LogEntry::_Internal {
  public:
 };
 
-LogEntry::LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+LogEntry::LogEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:raftRpcProto.LogEntry)
 }
 LogEntry::LogEntry(const LogEntry& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LogEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.command_){}
+    , decltype(_impl_.logterm_){}
+    , decltype(_impl_.logindex_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  command_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_command().empty()) {
-    command_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_command(),
-      GetArena());
+    _this->_impl_.command_.Set(from._internal_command(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&logterm_, &from.logterm_,
-    static_cast<size_t>(reinterpret_cast<char*>(&logindex_) -
-    reinterpret_cast<char*>(&logterm_)) + sizeof(logindex_));
+  ::memcpy(&_impl_.logterm_, &from._impl_.logterm_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.logterm_)) + sizeof(_impl_.type_));
   // @@protoc_insertion_point(copy_constructor:raftRpcProto.LogEntry)
 }
 
-void LogEntry::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_LogEntry_raftRPC_2eproto.base);
-  command_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&logterm_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&logindex_) -
-      reinterpret_cast<char*>(&logterm_)) + sizeof(logindex_));
+inline void LogEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.command_){}
+    , decltype(_impl_.logterm_){0}
+    , decltype(_impl_.logindex_){0}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 LogEntry::~LogEntry() {
   // @@protoc_insertion_point(destructor:raftRpcProto.LogEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void LogEntry::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  command_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void LogEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.command_.Destroy();
 }
 
-void LogEntry::ArenaDtor(void* object) {
-  LogEntry* _this = reinterpret_cast< LogEntry* >(object);
-  (void)_this;
-}
-void LogEntry::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void LogEntry::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const LogEntry& LogEntry::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_LogEntry_raftRPC_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void LogEntry::Clear() {
 // @@protoc_insertion_point(message_clear_start:raftRpcProto.LogEntry)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  command_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::memset(&logterm_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&logindex_) -
-      reinterpret_cast<char*>(&logterm_)) + sizeof(logindex_));
+  _impl_.command_.ClearToEmpty();
+  ::memset(&_impl_.logterm_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.type_) -
+      reinterpret_cast<char*>(&_impl_.logterm_)) + sizeof(_impl_.type_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* LogEntry::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* LogEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bytes Command = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_command();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 LogTerm = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          logterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.logterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 LogIndex = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          logindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.logindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .raftRpcProto.EntryType Type = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::raftRpcProto::EntryType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* LogEntry::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* LogEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.LogEntry)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes Command = 1;
-  if (this->command().size() > 0) {
+  if (!this->_internal_command().empty()) {
     target = stream->WriteBytesMaybeAliased(
         1, this->_internal_command(), target);
   }
 
   // int32 LogTerm = 2;
-  if (this->logterm() != 0) {
+  if (this->_internal_logterm() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_logterm(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_logterm(), target);
   }
 
   // int32 LogIndex = 3;
-  if (this->logindex() != 0) {
+  if (this->_internal_logindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_logindex(), target);
+  }
+
+  // .raftRpcProto.EntryType Type = 4;
+  if (this->_internal_type() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_logindex(), target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_type(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.LogEntry)
@@ -444,1753 +790,4163 @@ size_t LogEntry::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:raftRpcProto.LogEntry)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // bytes Command = 1;
-  if (this->command().size() > 0) {
+  if (!this->_internal_command().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_command());
   }
 
   // int32 LogTerm = 2;
-  if (this->logterm() != 0) {
+  if (this->_internal_logterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_logterm());
+  }
+
+  // int32 LogIndex = 3;
+  if (this->_internal_logindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_logindex());
+  }
+
+  // .raftRpcProto.EntryType Type = 4;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LogEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LogEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LogEntry::GetClassData() const { return &_class_data_; }
+
+
+void LogEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LogEntry*>(&to_msg);
+  auto& from = static_cast<const LogEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.LogEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_command().empty()) {
+    _this->_internal_set_command(from._internal_command());
+  }
+  if (from._internal_logterm() != 0) {
+    _this->_internal_set_logterm(from._internal_logterm());
+  }
+  if (from._internal_logindex() != 0) {
+    _this->_internal_set_logindex(from._internal_logindex());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LogEntry::CopyFrom(const LogEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.LogEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LogEntry::IsInitialized() const {
+  return true;
+}
+
+void LogEntry::InternalSwap(LogEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.command_, lhs_arena,
+      &other->_impl_.command_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LogEntry, _impl_.type_)
+      + sizeof(LogEntry::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(LogEntry, _impl_.logterm_)>(
+          reinterpret_cast<char*>(&_impl_.logterm_),
+          reinterpret_cast<char*>(&other->_impl_.logterm_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LogEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[0]);
+}
+
+// ===================================================================
+
+class PeerAddr::_Internal {
+ public:
+};
+
+PeerAddr::PeerAddr(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProto.PeerAddr)
+}
+PeerAddr::PeerAddr(const PeerAddr& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PeerAddr* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ip_){}
+    , decltype(_impl_.nodeid_){}
+    , decltype(_impl_.port_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_ip().empty()) {
+    _this->_impl_.ip_.Set(from._internal_ip(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.nodeid_, &from._impl_.nodeid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.port_) -
+    reinterpret_cast<char*>(&_impl_.nodeid_)) + sizeof(_impl_.port_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProto.PeerAddr)
+}
+
+inline void PeerAddr::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ip_){}
+    , decltype(_impl_.nodeid_){0}
+    , decltype(_impl_.port_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.ip_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PeerAddr::~PeerAddr() {
+  // @@protoc_insertion_point(destructor:raftRpcProto.PeerAddr)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PeerAddr::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ip_.Destroy();
+}
+
+void PeerAddr::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PeerAddr::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProto.PeerAddr)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ip_.ClearToEmpty();
+  ::memset(&_impl_.nodeid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.port_) -
+      reinterpret_cast<char*>(&_impl_.nodeid_)) + sizeof(_impl_.port_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PeerAddr::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 NodeId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.nodeid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string Ip = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_ip();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "raftRpcProto.PeerAddr.Ip"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 Port = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.port_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PeerAddr::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.PeerAddr)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 NodeId = 1;
+  if (this->_internal_nodeid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_nodeid(), target);
+  }
+
+  // string Ip = 2;
+  if (!this->_internal_ip().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_ip().data(), static_cast<int>(this->_internal_ip().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "raftRpcProto.PeerAddr.Ip");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_ip(), target);
+  }
+
+  // int32 Port = 3;
+  if (this->_internal_port() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_port(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.PeerAddr)
+  return target;
+}
+
+size_t PeerAddr::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.PeerAddr)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string Ip = 2;
+  if (!this->_internal_ip().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_logterm());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ip());
+  }
+
+  // int32 NodeId = 1;
+  if (this->_internal_nodeid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_nodeid());
+  }
+
+  // int32 Port = 3;
+  if (this->_internal_port() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_port());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PeerAddr::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PeerAddr::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PeerAddr::GetClassData() const { return &_class_data_; }
+
+
+void PeerAddr::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PeerAddr*>(&to_msg);
+  auto& from = static_cast<const PeerAddr&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.PeerAddr)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_ip().empty()) {
+    _this->_internal_set_ip(from._internal_ip());
   }
+  if (from._internal_nodeid() != 0) {
+    _this->_internal_set_nodeid(from._internal_nodeid());
+  }
+  if (from._internal_port() != 0) {
+    _this->_internal_set_port(from._internal_port());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PeerAddr::CopyFrom(const PeerAddr& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.PeerAddr)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PeerAddr::IsInitialized() const {
+  return true;
+}
+
+void PeerAddr::InternalSwap(PeerAddr* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_, lhs_arena,
+      &other->_impl_.ip_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PeerAddr, _impl_.port_)
+      + sizeof(PeerAddr::_impl_.port_)
+      - PROTOBUF_FIELD_OFFSET(PeerAddr, _impl_.nodeid_)>(
+          reinterpret_cast<char*>(&_impl_.nodeid_),
+          reinterpret_cast<char*>(&other->_impl_.nodeid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PeerAddr::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[1]);
+}
+
+// ===================================================================
+
+class ConfChange::_Internal {
+ public:
+};
+
+ConfChange::ConfChange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProto.ConfChange)
+}
+ConfChange::ConfChange(const ConfChange& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConfChange* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.voters_){from._impl_.voters_}
+    , /*decltype(_impl_._voters_cached_byte_size_)*/{0}
+    , decltype(_impl_.addrs_){from._impl_.addrs_}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.nodeid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.nodeid_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.nodeid_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProto.ConfChange)
+}
+
+inline void ConfChange::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.voters_){arena}
+    , /*decltype(_impl_._voters_cached_byte_size_)*/{0}
+    , decltype(_impl_.addrs_){arena}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.nodeid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ConfChange::~ConfChange() {
+  // @@protoc_insertion_point(destructor:raftRpcProto.ConfChange)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ConfChange::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.voters_.~RepeatedField();
+  _impl_.addrs_.~RepeatedPtrField();
+}
+
+void ConfChange::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConfChange::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProto.ConfChange)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.voters_.Clear();
+  _impl_.addrs_.Clear();
+  ::memset(&_impl_.type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.nodeid_) -
+      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.nodeid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConfChange::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .raftRpcProto.ConfChangeType Type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::raftRpcProto::ConfChangeType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 NodeId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.nodeid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 Voters = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_voters(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_voters(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftRpcProto.PeerAddr Addrs = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_addrs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConfChange::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.ConfChange)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .raftRpcProto.ConfChangeType Type = 1;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // int32 NodeId = 2;
+  if (this->_internal_nodeid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_nodeid(), target);
+  }
+
+  // repeated int32 Voters = 3;
+  {
+    int byte_size = _impl_._voters_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          3, _internal_voters(), byte_size, target);
+    }
+  }
+
+  // repeated .raftRpcProto.PeerAddr Addrs = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_addrs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_addrs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.ConfChange)
+  return target;
+}
+
+size_t ConfChange::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.ConfChange)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 Voters = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.voters_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._voters_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated .raftRpcProto.PeerAddr Addrs = 4;
+  total_size += 1UL * this->_internal_addrs_size();
+  for (const auto& msg : this->_impl_.addrs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .raftRpcProto.ConfChangeType Type = 1;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  // int32 NodeId = 2;
+  if (this->_internal_nodeid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_nodeid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConfChange::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConfChange::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConfChange::GetClassData() const { return &_class_data_; }
+
+
+void ConfChange::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConfChange*>(&to_msg);
+  auto& from = static_cast<const ConfChange&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.ConfChange)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.voters_.MergeFrom(from._impl_.voters_);
+  _this->_impl_.addrs_.MergeFrom(from._impl_.addrs_);
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (from._internal_nodeid() != 0) {
+    _this->_internal_set_nodeid(from._internal_nodeid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ConfChange::CopyFrom(const ConfChange& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.ConfChange)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConfChange::IsInitialized() const {
+  return true;
+}
+
+void ConfChange::InternalSwap(ConfChange* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.voters_.InternalSwap(&other->_impl_.voters_);
+  _impl_.addrs_.InternalSwap(&other->_impl_.addrs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ConfChange, _impl_.nodeid_)
+      + sizeof(ConfChange::_impl_.nodeid_)
+      - PROTOBUF_FIELD_OFFSET(ConfChange, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ConfChange::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[2]);
+}
+
+// ===================================================================
+
+class ClusterConfig::_Internal {
+ public:
+};
+
+ClusterConfig::ClusterConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProto.ClusterConfig)
+}
+ClusterConfig::ClusterConfig(const ClusterConfig& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClusterConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.voters_){from._impl_.voters_}
+    , /*decltype(_impl_._voters_cached_byte_size_)*/{0}
+    , decltype(_impl_.learners_){from._impl_.learners_}
+    , /*decltype(_impl_._learners_cached_byte_size_)*/{0}
+    , decltype(_impl_.outgoingvoters_){from._impl_.outgoingvoters_}
+    , /*decltype(_impl_._outgoingvoters_cached_byte_size_)*/{0}
+    , decltype(_impl_.addrs_){from._impl_.addrs_}
+    , decltype(_impl_.witnesses_){from._impl_.witnesses_}
+    , /*decltype(_impl_._witnesses_cached_byte_size_)*/{0}
+    , decltype(_impl_.index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.index_ = from._impl_.index_;
+  // @@protoc_insertion_point(copy_constructor:raftRpcProto.ClusterConfig)
+}
+
+inline void ClusterConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.voters_){arena}
+    , /*decltype(_impl_._voters_cached_byte_size_)*/{0}
+    , decltype(_impl_.learners_){arena}
+    , /*decltype(_impl_._learners_cached_byte_size_)*/{0}
+    , decltype(_impl_.outgoingvoters_){arena}
+    , /*decltype(_impl_._outgoingvoters_cached_byte_size_)*/{0}
+    , decltype(_impl_.addrs_){arena}
+    , decltype(_impl_.witnesses_){arena}
+    , /*decltype(_impl_._witnesses_cached_byte_size_)*/{0}
+    , decltype(_impl_.index_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ClusterConfig::~ClusterConfig() {
+  // @@protoc_insertion_point(destructor:raftRpcProto.ClusterConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ClusterConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.voters_.~RepeatedField();
+  _impl_.learners_.~RepeatedField();
+  _impl_.outgoingvoters_.~RepeatedField();
+  _impl_.addrs_.~RepeatedPtrField();
+  _impl_.witnesses_.~RepeatedField();
+}
+
+void ClusterConfig::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ClusterConfig::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProto.ClusterConfig)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.voters_.Clear();
+  _impl_.learners_.Clear();
+  _impl_.outgoingvoters_.Clear();
+  _impl_.addrs_.Clear();
+  _impl_.witnesses_.Clear();
+  _impl_.index_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClusterConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated int32 Voters = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_voters(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_voters(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 Learners = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_learners(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_learners(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 Index = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 OutgoingVoters = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_outgoingvoters(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_outgoingvoters(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftRpcProto.PeerAddr Addrs = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_addrs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 Witnesses = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_witnesses(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_witnesses(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ClusterConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.ClusterConfig)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated int32 Voters = 1;
+  {
+    int byte_size = _impl_._voters_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          1, _internal_voters(), byte_size, target);
+    }
+  }
+
+  // repeated int32 Learners = 2;
+  {
+    int byte_size = _impl_._learners_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2, _internal_learners(), byte_size, target);
+    }
+  }
+
+  // int32 Index = 3;
+  if (this->_internal_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_index(), target);
+  }
+
+  // repeated int32 OutgoingVoters = 4;
+  {
+    int byte_size = _impl_._outgoingvoters_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          4, _internal_outgoingvoters(), byte_size, target);
+    }
+  }
+
+  // repeated .raftRpcProto.PeerAddr Addrs = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_addrs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_addrs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated int32 Witnesses = 6;
+  {
+    int byte_size = _impl_._witnesses_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          6, _internal_witnesses(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.ClusterConfig)
+  return target;
+}
+
+size_t ClusterConfig::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.ClusterConfig)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 Voters = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.voters_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._voters_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 Learners = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.learners_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._learners_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 OutgoingVoters = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.outgoingvoters_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._outgoingvoters_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated .raftRpcProto.PeerAddr Addrs = 5;
+  total_size += 1UL * this->_internal_addrs_size();
+  for (const auto& msg : this->_impl_.addrs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated int32 Witnesses = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.witnesses_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._witnesses_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // int32 Index = 3;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClusterConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClusterConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClusterConfig::GetClassData() const { return &_class_data_; }
+
+
+void ClusterConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClusterConfig*>(&to_msg);
+  auto& from = static_cast<const ClusterConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.ClusterConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.voters_.MergeFrom(from._impl_.voters_);
+  _this->_impl_.learners_.MergeFrom(from._impl_.learners_);
+  _this->_impl_.outgoingvoters_.MergeFrom(from._impl_.outgoingvoters_);
+  _this->_impl_.addrs_.MergeFrom(from._impl_.addrs_);
+  _this->_impl_.witnesses_.MergeFrom(from._impl_.witnesses_);
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClusterConfig::CopyFrom(const ClusterConfig& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.ClusterConfig)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClusterConfig::IsInitialized() const {
+  return true;
+}
+
+void ClusterConfig::InternalSwap(ClusterConfig* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.voters_.InternalSwap(&other->_impl_.voters_);
+  _impl_.learners_.InternalSwap(&other->_impl_.learners_);
+  _impl_.outgoingvoters_.InternalSwap(&other->_impl_.outgoingvoters_);
+  _impl_.addrs_.InternalSwap(&other->_impl_.addrs_);
+  _impl_.witnesses_.InternalSwap(&other->_impl_.witnesses_);
+  swap(_impl_.index_, other->_impl_.index_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClusterConfig::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[3]);
+}
+
+// ===================================================================
+
+class AppendEntriesArgs::_Internal {
+ public:
+};
+
+AppendEntriesArgs::AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProto.AppendEntriesArgs)
+}
+AppendEntriesArgs::AppendEntriesArgs(const AppendEntriesArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AppendEntriesArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.prevlogindex_){}
+    , decltype(_impl_.prevlogterm_){}
+    , decltype(_impl_.leadercommit_){}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.groupid_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.groupid_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProto.AppendEntriesArgs)
+}
+
+inline void AppendEntriesArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , decltype(_impl_.term_){0}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.prevlogindex_){0}
+    , decltype(_impl_.prevlogterm_){0}
+    , decltype(_impl_.leadercommit_){0}
+    , decltype(_impl_.groupid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+AppendEntriesArgs::~AppendEntriesArgs() {
+  // @@protoc_insertion_point(destructor:raftRpcProto.AppendEntriesArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AppendEntriesArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+}
+
+void AppendEntriesArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AppendEntriesArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProto.AppendEntriesArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.groupid_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.groupid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AppendEntriesArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 Term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 PrevLogIndex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.prevlogindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 PrevLogTerm = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.prevlogterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .raftRpcProto.LogEntry Entries = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LeaderCommit = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.leadercommit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 GroupId = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AppendEntriesArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.AppendEntriesArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_leaderid(), target);
+  }
+
+  // int32 PrevLogIndex = 3;
+  if (this->_internal_prevlogindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_prevlogindex(), target);
+  }
+
+  // int32 PrevLogTerm = 4;
+  if (this->_internal_prevlogterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_prevlogterm(), target);
+  }
+
+  // repeated .raftRpcProto.LogEntry Entries = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int32 LeaderCommit = 6;
+  if (this->_internal_leadercommit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_leadercommit(), target);
+  }
+
+  // int32 GroupId = 7;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_groupid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.AppendEntriesArgs)
+  return target;
+}
+
+size_t AppendEntriesArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.AppendEntriesArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .raftRpcProto.LogEntry Entries = 5;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
+  }
+
+  // int32 PrevLogIndex = 3;
+  if (this->_internal_prevlogindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_prevlogindex());
+  }
+
+  // int32 PrevLogTerm = 4;
+  if (this->_internal_prevlogterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_prevlogterm());
+  }
+
+  // int32 LeaderCommit = 6;
+  if (this->_internal_leadercommit() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leadercommit());
+  }
+
+  // int32 GroupId = 7;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AppendEntriesArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AppendEntriesArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AppendEntriesArgs::GetClassData() const { return &_class_data_; }
+
+
+void AppendEntriesArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AppendEntriesArgs*>(&to_msg);
+  auto& from = static_cast<const AppendEntriesArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.AppendEntriesArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
+  }
+  if (from._internal_prevlogindex() != 0) {
+    _this->_internal_set_prevlogindex(from._internal_prevlogindex());
+  }
+  if (from._internal_prevlogterm() != 0) {
+    _this->_internal_set_prevlogterm(from._internal_prevlogterm());
+  }
+  if (from._internal_leadercommit() != 0) {
+    _this->_internal_set_leadercommit(from._internal_leadercommit());
+  }
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AppendEntriesArgs::CopyFrom(const AppendEntriesArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.AppendEntriesArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AppendEntriesArgs::IsInitialized() const {
+  return true;
+}
+
+void AppendEntriesArgs::InternalSwap(AppendEntriesArgs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AppendEntriesArgs, _impl_.groupid_)
+      + sizeof(AppendEntriesArgs::_impl_.groupid_)
+      - PROTOBUF_FIELD_OFFSET(AppendEntriesArgs, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AppendEntriesArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[4]);
+}
+
+// ===================================================================
+
+class AppendEntriesReply::_Internal {
+ public:
+};
+
+AppendEntriesReply::AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProto.AppendEntriesReply)
+}
+AppendEntriesReply::AppendEntriesReply(const AppendEntriesReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AppendEntriesReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.updatenextindex_){}
+    , decltype(_impl_.appstate_){}
+    , decltype(_impl_.conflictterm_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.conflictterm_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.conflictterm_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProto.AppendEntriesReply)
+}
+
+inline void AppendEntriesReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.updatenextindex_){0}
+    , decltype(_impl_.appstate_){0}
+    , decltype(_impl_.conflictterm_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+AppendEntriesReply::~AppendEntriesReply() {
+  // @@protoc_insertion_point(destructor:raftRpcProto.AppendEntriesReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AppendEntriesReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void AppendEntriesReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AppendEntriesReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProto.AppendEntriesReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.conflictterm_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.conflictterm_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AppendEntriesReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 Term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool Success = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 UpdateNextIndex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.updatenextindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 AppState = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.appstate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 ConflictTerm = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.conflictterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AppendEntriesReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.AppendEntriesReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // bool Success = 2;
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
+  }
+
+  // int32 UpdateNextIndex = 3;
+  if (this->_internal_updatenextindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_updatenextindex(), target);
+  }
+
+  // int32 AppState = 4;
+  if (this->_internal_appstate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_appstate(), target);
+  }
+
+  // int32 ConflictTerm = 5;
+  if (this->_internal_conflictterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_conflictterm(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.AppendEntriesReply)
+  return target;
+}
+
+size_t AppendEntriesReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.AppendEntriesReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  // bool Success = 2;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 UpdateNextIndex = 3;
+  if (this->_internal_updatenextindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_updatenextindex());
+  }
+
+  // int32 AppState = 4;
+  if (this->_internal_appstate() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_appstate());
+  }
+
+  // int32 ConflictTerm = 5;
+  if (this->_internal_conflictterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_conflictterm());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AppendEntriesReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AppendEntriesReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AppendEntriesReply::GetClassData() const { return &_class_data_; }
+
+
+void AppendEntriesReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AppendEntriesReply*>(&to_msg);
+  auto& from = static_cast<const AppendEntriesReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.AppendEntriesReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  if (from._internal_updatenextindex() != 0) {
+    _this->_internal_set_updatenextindex(from._internal_updatenextindex());
+  }
+  if (from._internal_appstate() != 0) {
+    _this->_internal_set_appstate(from._internal_appstate());
+  }
+  if (from._internal_conflictterm() != 0) {
+    _this->_internal_set_conflictterm(from._internal_conflictterm());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AppendEntriesReply::CopyFrom(const AppendEntriesReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.AppendEntriesReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AppendEntriesReply::IsInitialized() const {
+  return true;
+}
+
+void AppendEntriesReply::InternalSwap(AppendEntriesReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AppendEntriesReply, _impl_.conflictterm_)
+      + sizeof(AppendEntriesReply::_impl_.conflictterm_)
+      - PROTOBUF_FIELD_OFFSET(AppendEntriesReply, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AppendEntriesReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[5]);
+}
+
+// ===================================================================
+
+class RequestVoteArgs::_Internal {
+ public:
+};
+
+RequestVoteArgs::RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProto.RequestVoteArgs)
+}
+RequestVoteArgs::RequestVoteArgs(const RequestVoteArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestVoteArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.candidateid_){}
+    , decltype(_impl_.lastlogindex_){}
+    , decltype(_impl_.lastlogterm_){}
+    , decltype(_impl_.prevote_){}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.groupid_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.groupid_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProto.RequestVoteArgs)
+}
+
+inline void RequestVoteArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.candidateid_){0}
+    , decltype(_impl_.lastlogindex_){0}
+    , decltype(_impl_.lastlogterm_){0}
+    , decltype(_impl_.prevote_){false}
+    , decltype(_impl_.groupid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RequestVoteArgs::~RequestVoteArgs() {
+  // @@protoc_insertion_point(destructor:raftRpcProto.RequestVoteArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestVoteArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RequestVoteArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestVoteArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProto.RequestVoteArgs)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.groupid_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.groupid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestVoteArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 Term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 CandidateId = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.candidateid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LastLogIndex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.lastlogindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LastLogTerm = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.lastlogterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool PreVote = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.prevote_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 GroupId = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestVoteArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.RequestVoteArgs)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // int32 CandidateId = 2;
+  if (this->_internal_candidateid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_candidateid(), target);
+  }
+
+  // int32 LastLogIndex = 3;
+  if (this->_internal_lastlogindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_lastlogindex(), target);
+  }
+
+  // int32 LastLogTerm = 4;
+  if (this->_internal_lastlogterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_lastlogterm(), target);
+  }
+
+  // bool PreVote = 5;
+  if (this->_internal_prevote() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_prevote(), target);
+  }
+
+  // int32 GroupId = 6;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_groupid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.RequestVoteArgs)
+  return target;
+}
+
+size_t RequestVoteArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.RequestVoteArgs)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  // int32 CandidateId = 2;
+  if (this->_internal_candidateid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_candidateid());
+  }
+
+  // int32 LastLogIndex = 3;
+  if (this->_internal_lastlogindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_lastlogindex());
+  }
+
+  // int32 LastLogTerm = 4;
+  if (this->_internal_lastlogterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_lastlogterm());
+  }
+
+  // bool PreVote = 5;
+  if (this->_internal_prevote() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 GroupId = 6;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestVoteArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestVoteArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestVoteArgs::GetClassData() const { return &_class_data_; }
+
+
+void RequestVoteArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestVoteArgs*>(&to_msg);
+  auto& from = static_cast<const RequestVoteArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.RequestVoteArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_candidateid() != 0) {
+    _this->_internal_set_candidateid(from._internal_candidateid());
+  }
+  if (from._internal_lastlogindex() != 0) {
+    _this->_internal_set_lastlogindex(from._internal_lastlogindex());
+  }
+  if (from._internal_lastlogterm() != 0) {
+    _this->_internal_set_lastlogterm(from._internal_lastlogterm());
+  }
+  if (from._internal_prevote() != 0) {
+    _this->_internal_set_prevote(from._internal_prevote());
+  }
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestVoteArgs::CopyFrom(const RequestVoteArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.RequestVoteArgs)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestVoteArgs::IsInitialized() const {
+  return true;
+}
+
+void RequestVoteArgs::InternalSwap(RequestVoteArgs* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RequestVoteArgs, _impl_.groupid_)
+      + sizeof(RequestVoteArgs::_impl_.groupid_)
+      - PROTOBUF_FIELD_OFFSET(RequestVoteArgs, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestVoteArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[6]);
+}
+
+// ===================================================================
+
+class RequestVoteReply::_Internal {
+ public:
+};
+
+RequestVoteReply::RequestVoteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProto.RequestVoteReply)
+}
+RequestVoteReply::RequestVoteReply(const RequestVoteReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestVoteReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.votestate_){}
+    , decltype(_impl_.votegranted_){}
+    , decltype(_impl_.prevote_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.prevote_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.prevote_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProto.RequestVoteReply)
+}
+
+inline void RequestVoteReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.votestate_){0}
+    , decltype(_impl_.votegranted_){false}
+    , decltype(_impl_.prevote_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RequestVoteReply::~RequestVoteReply() {
+  // @@protoc_insertion_point(destructor:raftRpcProto.RequestVoteReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestVoteReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RequestVoteReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestVoteReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProto.RequestVoteReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.prevote_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.prevote_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestVoteReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 Term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool VoteGranted = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.votegranted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 VoteState = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.votestate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool PreVote = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.prevote_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestVoteReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.RequestVoteReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // bool VoteGranted = 2;
+  if (this->_internal_votegranted() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_votegranted(), target);
+  }
+
+  // int32 VoteState = 3;
+  if (this->_internal_votestate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_votestate(), target);
+  }
+
+  // bool PreVote = 4;
+  if (this->_internal_prevote() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_prevote(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.RequestVoteReply)
+  return target;
+}
+
+size_t RequestVoteReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.RequestVoteReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  // int32 VoteState = 3;
+  if (this->_internal_votestate() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_votestate());
+  }
+
+  // bool VoteGranted = 2;
+  if (this->_internal_votegranted() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool PreVote = 4;
+  if (this->_internal_prevote() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestVoteReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestVoteReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestVoteReply::GetClassData() const { return &_class_data_; }
+
+
+void RequestVoteReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestVoteReply*>(&to_msg);
+  auto& from = static_cast<const RequestVoteReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.RequestVoteReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_votestate() != 0) {
+    _this->_internal_set_votestate(from._internal_votestate());
+  }
+  if (from._internal_votegranted() != 0) {
+    _this->_internal_set_votegranted(from._internal_votegranted());
+  }
+  if (from._internal_prevote() != 0) {
+    _this->_internal_set_prevote(from._internal_prevote());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestVoteReply::CopyFrom(const RequestVoteReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.RequestVoteReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RequestVoteReply::IsInitialized() const {
+  return true;
+}
+
+void RequestVoteReply::InternalSwap(RequestVoteReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RequestVoteReply, _impl_.prevote_)
+      + sizeof(RequestVoteReply::_impl_.prevote_)
+      - PROTOBUF_FIELD_OFFSET(RequestVoteReply, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestVoteReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[7]);
+}
+
+// ===================================================================
+
+class InstallSnapshotRequest::_Internal {
+ public:
+  static const ::raftRpcProto::ClusterConfig& config(const InstallSnapshotRequest* msg);
+};
+
+const ::raftRpcProto::ClusterConfig&
+InstallSnapshotRequest::_Internal::config(const InstallSnapshotRequest* msg) {
+  return *msg->_impl_.config_;
+}
+InstallSnapshotRequest::InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProto.InstallSnapshotRequest)
+}
+InstallSnapshotRequest::InstallSnapshotRequest(const InstallSnapshotRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InstallSnapshotRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.lastsnapshotincludeindex_){}
+    , decltype(_impl_.lastsnapshotincludeterm_){}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.done_){}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_config()) {
+    _this->_impl_.config_ = new ::raftRpcProto::ClusterConfig(*from._impl_.config_);
+  }
+  ::memcpy(&_impl_.leaderid_, &from._impl_.leaderid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.groupid_) -
+    reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.groupid_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProto.InstallSnapshotRequest)
+}
+
+inline void InstallSnapshotRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.term_){0}
+    , decltype(_impl_.lastsnapshotincludeindex_){0}
+    , decltype(_impl_.lastsnapshotincludeterm_){0}
+    , decltype(_impl_.offset_){int64_t{0}}
+    , decltype(_impl_.done_){false}
+    , decltype(_impl_.groupid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+InstallSnapshotRequest::~InstallSnapshotRequest() {
+  // @@protoc_insertion_point(destructor:raftRpcProto.InstallSnapshotRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InstallSnapshotRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.config_;
+}
+
+void InstallSnapshotRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InstallSnapshotRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProto.InstallSnapshotRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.config_ != nullptr) {
+    delete _impl_.config_;
+  }
+  _impl_.config_ = nullptr;
+  ::memset(&_impl_.leaderid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.groupid_) -
+      reinterpret_cast<char*>(&_impl_.leaderid_)) + sizeof(_impl_.groupid_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InstallSnapshotRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 LeaderId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 Term = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LastSnapShotIncludeIndex = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.lastsnapshotincludeindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 LastSnapShotIncludeTerm = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.lastsnapshotincludeterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes Data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 Offset = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool Done = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.done_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 GroupId = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .raftRpcProto.ClusterConfig Config = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_config(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InstallSnapshotRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.InstallSnapshotRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 LeaderId = 1;
+  if (this->_internal_leaderid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_leaderid(), target);
+  }
+
+  // int32 Term = 2;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_term(), target);
+  }
+
+  // int32 LastSnapShotIncludeIndex = 3;
+  if (this->_internal_lastsnapshotincludeindex() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_lastsnapshotincludeindex(), target);
+  }
+
+  // int32 LastSnapShotIncludeTerm = 4;
+  if (this->_internal_lastsnapshotincludeterm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_lastsnapshotincludeterm(), target);
+  }
+
+  // bytes Data = 5;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_data(), target);
+  }
+
+  // int64 Offset = 6;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_offset(), target);
+  }
+
+  // bool Done = 7;
+  if (this->_internal_done() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_done(), target);
+  }
+
+  // int32 GroupId = 8;
+  if (this->_internal_groupid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_groupid(), target);
+  }
+
+  // .raftRpcProto.ClusterConfig Config = 9;
+  if (this->_internal_has_config()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::config(this),
+        _Internal::config(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.InstallSnapshotRequest)
+  return target;
+}
+
+size_t InstallSnapshotRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.InstallSnapshotRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes Data = 5;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  // .raftRpcProto.ClusterConfig Config = 9;
+  if (this->_internal_has_config()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.config_);
+  }
+
+  // int32 LeaderId = 1;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
+  }
+
+  // int32 Term = 2;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
+  }
+
+  // int32 LastSnapShotIncludeIndex = 3;
+  if (this->_internal_lastsnapshotincludeindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_lastsnapshotincludeindex());
+  }
+
+  // int32 LastSnapShotIncludeTerm = 4;
+  if (this->_internal_lastsnapshotincludeterm() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_lastsnapshotincludeterm());
+  }
+
+  // int64 Offset = 6;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_offset());
+  }
+
+  // bool Done = 7;
+  if (this->_internal_done() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // int32 GroupId = 8;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InstallSnapshotRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InstallSnapshotRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InstallSnapshotRequest::GetClassData() const { return &_class_data_; }
+
+
+void InstallSnapshotRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InstallSnapshotRequest*>(&to_msg);
+  auto& from = static_cast<const InstallSnapshotRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.InstallSnapshotRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_has_config()) {
+    _this->_internal_mutable_config()->::raftRpcProto::ClusterConfig::MergeFrom(
+        from._internal_config());
+  }
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
+  }
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
+  }
+  if (from._internal_lastsnapshotincludeindex() != 0) {
+    _this->_internal_set_lastsnapshotincludeindex(from._internal_lastsnapshotincludeindex());
+  }
+  if (from._internal_lastsnapshotincludeterm() != 0) {
+    _this->_internal_set_lastsnapshotincludeterm(from._internal_lastsnapshotincludeterm());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_done() != 0) {
+    _this->_internal_set_done(from._internal_done());
+  }
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void InstallSnapshotRequest::CopyFrom(const InstallSnapshotRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.InstallSnapshotRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InstallSnapshotRequest::IsInitialized() const {
+  return true;
+}
+
+void InstallSnapshotRequest::InternalSwap(InstallSnapshotRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InstallSnapshotRequest, _impl_.groupid_)
+      + sizeof(InstallSnapshotRequest::_impl_.groupid_)
+      - PROTOBUF_FIELD_OFFSET(InstallSnapshotRequest, _impl_.config_)>(
+          reinterpret_cast<char*>(&_impl_.config_),
+          reinterpret_cast<char*>(&other->_impl_.config_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InstallSnapshotRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[8]);
+}
+
+// ===================================================================
+
+class InstallSnapshotResponse::_Internal {
+ public:
+};
+
+InstallSnapshotResponse::InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProto.InstallSnapshotResponse)
+}
+InstallSnapshotResponse::InstallSnapshotResponse(const InstallSnapshotResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InstallSnapshotResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.offset_){}
+    , decltype(_impl_.term_){}
+    , decltype(_impl_.installed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.offset_, &from._impl_.offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.installed_) -
+    reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.installed_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProto.InstallSnapshotResponse)
+}
+
+inline void InstallSnapshotResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.offset_){int64_t{0}}
+    , decltype(_impl_.term_){0}
+    , decltype(_impl_.installed_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+InstallSnapshotResponse::~InstallSnapshotResponse() {
+  // @@protoc_insertion_point(destructor:raftRpcProto.InstallSnapshotResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InstallSnapshotResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void InstallSnapshotResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InstallSnapshotResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProto.InstallSnapshotResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.offset_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.installed_) -
+      reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.installed_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InstallSnapshotResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 Term = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 Offset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool Installed = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.installed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InstallSnapshotResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.InstallSnapshotResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  }
+
+  // int64 Offset = 2;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_offset(), target);
+  }
+
+  // bool Installed = 3;
+  if (this->_internal_installed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_installed(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.InstallSnapshotResponse)
+  return target;
+}
+
+size_t InstallSnapshotResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.InstallSnapshotResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // int32 LogIndex = 3;
-  if (this->logindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_logindex());
+  // int64 Offset = 2;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_offset());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // int32 Term = 1;
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void LogEntry::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProto.LogEntry)
-  GOOGLE_DCHECK_NE(&from, this);
-  const LogEntry* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<LogEntry>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProto.LogEntry)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProto.LogEntry)
-    MergeFrom(*source);
+  // bool Installed = 3;
+  if (this->_internal_installed() != 0) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void LogEntry::MergeFrom(const LogEntry& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.LogEntry)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InstallSnapshotResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InstallSnapshotResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InstallSnapshotResponse::GetClassData() const { return &_class_data_; }
+
+
+void InstallSnapshotResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InstallSnapshotResponse*>(&to_msg);
+  auto& from = static_cast<const InstallSnapshotResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.InstallSnapshotResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.command().size() > 0) {
-    _internal_set_command(from._internal_command());
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
   }
-  if (from.logterm() != 0) {
-    _internal_set_logterm(from._internal_logterm());
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
   }
-  if (from.logindex() != 0) {
-    _internal_set_logindex(from._internal_logindex());
+  if (from._internal_installed() != 0) {
+    _this->_internal_set_installed(from._internal_installed());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void LogEntry::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProto.LogEntry)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void LogEntry::CopyFrom(const LogEntry& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.LogEntry)
+void InstallSnapshotResponse::CopyFrom(const InstallSnapshotResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.InstallSnapshotResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool LogEntry::IsInitialized() const {
+bool InstallSnapshotResponse::IsInitialized() const {
   return true;
 }
 
-void LogEntry::InternalSwap(LogEntry* other) {
+void InstallSnapshotResponse::InternalSwap(InstallSnapshotResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  command_.Swap(&other->command_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(LogEntry, logindex_)
-      + sizeof(LogEntry::logindex_)
-      - PROTOBUF_FIELD_OFFSET(LogEntry, logterm_)>(
-          reinterpret_cast<char*>(&logterm_),
-          reinterpret_cast<char*>(&other->logterm_));
+      PROTOBUF_FIELD_OFFSET(InstallSnapshotResponse, _impl_.installed_)
+      + sizeof(InstallSnapshotResponse::_impl_.installed_)
+      - PROTOBUF_FIELD_OFFSET(InstallSnapshotResponse, _impl_.offset_)>(
+          reinterpret_cast<char*>(&_impl_.offset_),
+          reinterpret_cast<char*>(&other->_impl_.offset_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata LogEntry::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata InstallSnapshotResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[9]);
 }
 
-
 // ===================================================================
 
-void AppendEntriesArgs::InitAsDefaultInstance() {
-}
-class AppendEntriesArgs::_Internal {
+class ReadIndexArgs::_Internal {
  public:
 };
 
-AppendEntriesArgs::AppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  entries_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProto.AppendEntriesArgs)
-}
-AppendEntriesArgs::AppendEntriesArgs(const AppendEntriesArgs& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      entries_(from.entries_) {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&term_, &from.term_,
-    static_cast<size_t>(reinterpret_cast<char*>(&leadercommit_) -
-    reinterpret_cast<char*>(&term_)) + sizeof(leadercommit_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProto.AppendEntriesArgs)
-}
-
-void AppendEntriesArgs::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AppendEntriesArgs_raftRPC_2eproto.base);
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&leadercommit_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(leadercommit_));
+ReadIndexArgs::ReadIndexArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProto.ReadIndexArgs)
 }
+ReadIndexArgs::ReadIndexArgs(const ReadIndexArgs& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReadIndexArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.followerid_){}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-AppendEntriesArgs::~AppendEntriesArgs() {
-  // @@protoc_insertion_point(destructor:raftRpcProto.AppendEntriesArgs)
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.groupid_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.groupid_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProto.ReadIndexArgs)
+}
+
+inline void ReadIndexArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.followerid_){0}
+    , decltype(_impl_.groupid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReadIndexArgs::~ReadIndexArgs() {
+  // @@protoc_insertion_point(destructor:raftRpcProto.ReadIndexArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void AppendEntriesArgs::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void ReadIndexArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void AppendEntriesArgs::ArenaDtor(void* object) {
-  AppendEntriesArgs* _this = reinterpret_cast< AppendEntriesArgs* >(object);
-  (void)_this;
-}
-void AppendEntriesArgs::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void AppendEntriesArgs::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void ReadIndexArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const AppendEntriesArgs& AppendEntriesArgs::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AppendEntriesArgs_raftRPC_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void AppendEntriesArgs::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProto.AppendEntriesArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ReadIndexArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProto.ReadIndexArgs)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  entries_.Clear();
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&leadercommit_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(leadercommit_));
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.groupid_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.groupid_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* AppendEntriesArgs::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ReadIndexArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 Term = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 LeaderId = 2;
+      // int32 FollowerId = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.followerid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 PrevLogIndex = 3;
+      // int32 GroupId = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          prevlogindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 PrevLogTerm = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          prevlogterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // repeated .raftRpcProto.LogEntry Entries = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 LeaderCommit = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
-          leadercommit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* AppendEntriesArgs::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.AppendEntriesArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* ReadIndexArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.ReadIndexArgs)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
-  }
-
-  // int32 LeaderId = 2;
-  if (this->leaderid() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_leaderid(), target);
-  }
-
-  // int32 PrevLogIndex = 3;
-  if (this->prevlogindex() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_prevlogindex(), target);
-  }
-
-  // int32 PrevLogTerm = 4;
-  if (this->prevlogterm() != 0) {
+  if (this->_internal_term() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_prevlogterm(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
   }
 
-  // repeated .raftRpcProto.LogEntry Entries = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_entries_size()); i < n; i++) {
+  // int32 FollowerId = 2;
+  if (this->_internal_followerid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, this->_internal_entries(i), target, stream);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_followerid(), target);
   }
 
-  // int32 LeaderCommit = 6;
-  if (this->leadercommit() != 0) {
+  // int32 GroupId = 3;
+  if (this->_internal_groupid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(6, this->_internal_leadercommit(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_groupid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.AppendEntriesArgs)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.ReadIndexArgs)
   return target;
 }
 
-size_t AppendEntriesArgs::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.AppendEntriesArgs)
+size_t ReadIndexArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.ReadIndexArgs)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .raftRpcProto.LogEntry Entries = 5;
-  total_size += 1UL * this->_internal_entries_size();
-  for (const auto& msg : this->entries_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
   // int32 Term = 1;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
-  }
-
-  // int32 LeaderId = 2;
-  if (this->leaderid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_leaderid());
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
   }
 
-  // int32 PrevLogIndex = 3;
-  if (this->prevlogindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_prevlogindex());
-  }
-
-  // int32 PrevLogTerm = 4;
-  if (this->prevlogterm() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_prevlogterm());
+  // int32 FollowerId = 2;
+  if (this->_internal_followerid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_followerid());
   }
 
-  // int32 LeaderCommit = 6;
-  if (this->leadercommit() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_leadercommit());
+  // int32 GroupId = 3;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void AppendEntriesArgs::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProto.AppendEntriesArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  const AppendEntriesArgs* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AppendEntriesArgs>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProto.AppendEntriesArgs)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProto.AppendEntriesArgs)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadIndexArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadIndexArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadIndexArgs::GetClassData() const { return &_class_data_; }
 
-void AppendEntriesArgs::MergeFrom(const AppendEntriesArgs& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.AppendEntriesArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void ReadIndexArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadIndexArgs*>(&to_msg);
+  auto& from = static_cast<const ReadIndexArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.ReadIndexArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  entries_.MergeFrom(from.entries_);
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
-  }
-  if (from.leaderid() != 0) {
-    _internal_set_leaderid(from._internal_leaderid());
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
   }
-  if (from.prevlogindex() != 0) {
-    _internal_set_prevlogindex(from._internal_prevlogindex());
+  if (from._internal_followerid() != 0) {
+    _this->_internal_set_followerid(from._internal_followerid());
   }
-  if (from.prevlogterm() != 0) {
-    _internal_set_prevlogterm(from._internal_prevlogterm());
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
   }
-  if (from.leadercommit() != 0) {
-    _internal_set_leadercommit(from._internal_leadercommit());
-  }
-}
-
-void AppendEntriesArgs::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProto.AppendEntriesArgs)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void AppendEntriesArgs::CopyFrom(const AppendEntriesArgs& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.AppendEntriesArgs)
+void ReadIndexArgs::CopyFrom(const ReadIndexArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.ReadIndexArgs)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AppendEntriesArgs::IsInitialized() const {
+bool ReadIndexArgs::IsInitialized() const {
   return true;
 }
 
-void AppendEntriesArgs::InternalSwap(AppendEntriesArgs* other) {
+void ReadIndexArgs::InternalSwap(ReadIndexArgs* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  entries_.InternalSwap(&other->entries_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AppendEntriesArgs, leadercommit_)
-      + sizeof(AppendEntriesArgs::leadercommit_)
-      - PROTOBUF_FIELD_OFFSET(AppendEntriesArgs, term_)>(
-          reinterpret_cast<char*>(&term_),
-          reinterpret_cast<char*>(&other->term_));
+      PROTOBUF_FIELD_OFFSET(ReadIndexArgs, _impl_.groupid_)
+      + sizeof(ReadIndexArgs::_impl_.groupid_)
+      - PROTOBUF_FIELD_OFFSET(ReadIndexArgs, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata AppendEntriesArgs::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata ReadIndexArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[10]);
 }
 
-
 // ===================================================================
 
-void AppendEntriesReply::InitAsDefaultInstance() {
-}
-class AppendEntriesReply::_Internal {
+class ReadIndexReply::_Internal {
  public:
 };
 
-AppendEntriesReply::AppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProto.AppendEntriesReply)
+ReadIndexReply::ReadIndexReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProto.ReadIndexReply)
 }
-AppendEntriesReply::AppendEntriesReply(const AppendEntriesReply& from)
+ReadIndexReply::ReadIndexReply(const ReadIndexReply& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&term_, &from.term_,
-    static_cast<size_t>(reinterpret_cast<char*>(&appstate_) -
-    reinterpret_cast<char*>(&term_)) + sizeof(appstate_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProto.AppendEntriesReply)
-}
-
-void AppendEntriesReply::SharedCtor() {
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&appstate_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(appstate_));
-}
+  ReadIndexReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.readindex_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-AppendEntriesReply::~AppendEntriesReply() {
-  // @@protoc_insertion_point(destructor:raftRpcProto.AppendEntriesReply)
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.readindex_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.readindex_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProto.ReadIndexReply)
+}
+
+inline void ReadIndexReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.readindex_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReadIndexReply::~ReadIndexReply() {
+  // @@protoc_insertion_point(destructor:raftRpcProto.ReadIndexReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void AppendEntriesReply::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void ReadIndexReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void AppendEntriesReply::ArenaDtor(void* object) {
-  AppendEntriesReply* _this = reinterpret_cast< AppendEntriesReply* >(object);
-  (void)_this;
-}
-void AppendEntriesReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void AppendEntriesReply::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void ReadIndexReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const AppendEntriesReply& AppendEntriesReply::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AppendEntriesReply_raftRPC_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void AppendEntriesReply::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProto.AppendEntriesReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ReadIndexReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProto.ReadIndexReply)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&appstate_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(appstate_));
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.readindex_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.readindex_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* AppendEntriesReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ReadIndexReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 Term = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bool Success = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 UpdateNextIndex = 3;
+      // int32 ReadIndex = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          updatenextindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.readindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 AppState = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          appstate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* AppendEntriesReply::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.AppendEntriesReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* ReadIndexReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.ReadIndexReply)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
+  if (this->_internal_term() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
   }
 
   // bool Success = 2;
-  if (this->success() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
-  }
-
-  // int32 UpdateNextIndex = 3;
-  if (this->updatenextindex() != 0) {
+  if (this->_internal_success() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_updatenextindex(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
   }
 
-  // int32 AppState = 4;
-  if (this->appstate() != 0) {
+  // int32 ReadIndex = 3;
+  if (this->_internal_readindex() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_appstate(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_readindex(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.AppendEntriesReply)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.ReadIndexReply)
   return target;
 }
 
-size_t AppendEntriesReply::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.AppendEntriesReply)
+size_t ReadIndexReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.ReadIndexReply)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
   }
 
   // bool Success = 2;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  // int32 UpdateNextIndex = 3;
-  if (this->updatenextindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_updatenextindex());
-  }
-
-  // int32 AppState = 4;
-  if (this->appstate() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_appstate());
+  // int32 ReadIndex = 3;
+  if (this->_internal_readindex() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_readindex());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void AppendEntriesReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProto.AppendEntriesReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  const AppendEntriesReply* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AppendEntriesReply>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProto.AppendEntriesReply)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProto.AppendEntriesReply)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReadIndexReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReadIndexReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReadIndexReply::GetClassData() const { return &_class_data_; }
 
-void AppendEntriesReply::MergeFrom(const AppendEntriesReply& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.AppendEntriesReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void ReadIndexReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReadIndexReply*>(&to_msg);
+  auto& from = static_cast<const ReadIndexReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.ReadIndexReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
   }
-  if (from.success() != 0) {
-    _internal_set_success(from._internal_success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-  if (from.updatenextindex() != 0) {
-    _internal_set_updatenextindex(from._internal_updatenextindex());
+  if (from._internal_readindex() != 0) {
+    _this->_internal_set_readindex(from._internal_readindex());
   }
-  if (from.appstate() != 0) {
-    _internal_set_appstate(from._internal_appstate());
-  }
-}
-
-void AppendEntriesReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProto.AppendEntriesReply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void AppendEntriesReply::CopyFrom(const AppendEntriesReply& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.AppendEntriesReply)
+void ReadIndexReply::CopyFrom(const ReadIndexReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.ReadIndexReply)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AppendEntriesReply::IsInitialized() const {
+bool ReadIndexReply::IsInitialized() const {
   return true;
 }
 
-void AppendEntriesReply::InternalSwap(AppendEntriesReply* other) {
+void ReadIndexReply::InternalSwap(ReadIndexReply* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AppendEntriesReply, appstate_)
-      + sizeof(AppendEntriesReply::appstate_)
-      - PROTOBUF_FIELD_OFFSET(AppendEntriesReply, term_)>(
-          reinterpret_cast<char*>(&term_),
-          reinterpret_cast<char*>(&other->term_));
+      PROTOBUF_FIELD_OFFSET(ReadIndexReply, _impl_.readindex_)
+      + sizeof(ReadIndexReply::_impl_.readindex_)
+      - PROTOBUF_FIELD_OFFSET(ReadIndexReply, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata AppendEntriesReply::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata ReadIndexReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[11]);
 }
 
-
 // ===================================================================
 
-void RequestVoteArgs::InitAsDefaultInstance() {
-}
-class RequestVoteArgs::_Internal {
+class TimeoutNowArgs::_Internal {
  public:
 };
 
-RequestVoteArgs::RequestVoteArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProto.RequestVoteArgs)
+TimeoutNowArgs::TimeoutNowArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProto.TimeoutNowArgs)
 }
-RequestVoteArgs::RequestVoteArgs(const RequestVoteArgs& from)
+TimeoutNowArgs::TimeoutNowArgs(const TimeoutNowArgs& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&term_, &from.term_,
-    static_cast<size_t>(reinterpret_cast<char*>(&lastlogterm_) -
-    reinterpret_cast<char*>(&term_)) + sizeof(lastlogterm_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProto.RequestVoteArgs)
-}
-
-void RequestVoteArgs::SharedCtor() {
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lastlogterm_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(lastlogterm_));
-}
+  TimeoutNowArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.leaderid_){}
+    , decltype(_impl_.groupid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-RequestVoteArgs::~RequestVoteArgs() {
-  // @@protoc_insertion_point(destructor:raftRpcProto.RequestVoteArgs)
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.groupid_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.groupid_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProto.TimeoutNowArgs)
+}
+
+inline void TimeoutNowArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.leaderid_){0}
+    , decltype(_impl_.groupid_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TimeoutNowArgs::~TimeoutNowArgs() {
+  // @@protoc_insertion_point(destructor:raftRpcProto.TimeoutNowArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void RequestVoteArgs::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void TimeoutNowArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void RequestVoteArgs::ArenaDtor(void* object) {
-  RequestVoteArgs* _this = reinterpret_cast< RequestVoteArgs* >(object);
-  (void)_this;
-}
-void RequestVoteArgs::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TimeoutNowArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-void RequestVoteArgs::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RequestVoteArgs& RequestVoteArgs::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RequestVoteArgs_raftRPC_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void RequestVoteArgs::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProto.RequestVoteArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void TimeoutNowArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProto.TimeoutNowArgs)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lastlogterm_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(lastlogterm_));
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.groupid_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.groupid_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RequestVoteArgs::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TimeoutNowArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 Term = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 CandidateId = 2;
+      // int32 LeaderId = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          candidateid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 LastLogIndex = 3;
+      // int32 GroupId = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          lastlogindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.groupid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 LastLogTerm = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          lastlogterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RequestVoteArgs::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.RequestVoteArgs)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* TimeoutNowArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.TimeoutNowArgs)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
+  if (this->_internal_term() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
   }
 
-  // int32 CandidateId = 2;
-  if (this->candidateid() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_candidateid(), target);
-  }
-
-  // int32 LastLogIndex = 3;
-  if (this->lastlogindex() != 0) {
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_lastlogindex(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_leaderid(), target);
   }
 
-  // int32 LastLogTerm = 4;
-  if (this->lastlogterm() != 0) {
+  // int32 GroupId = 3;
+  if (this->_internal_groupid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_lastlogterm(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_groupid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.RequestVoteArgs)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.TimeoutNowArgs)
   return target;
 }
 
-size_t RequestVoteArgs::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.RequestVoteArgs)
+size_t TimeoutNowArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.TimeoutNowArgs)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
-  }
-
-  // int32 CandidateId = 2;
-  if (this->candidateid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_candidateid());
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
   }
 
-  // int32 LastLogIndex = 3;
-  if (this->lastlogindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_lastlogindex());
+  // int32 LeaderId = 2;
+  if (this->_internal_leaderid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_leaderid());
   }
 
-  // int32 LastLogTerm = 4;
-  if (this->lastlogterm() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_lastlogterm());
+  // int32 GroupId = 3;
+  if (this->_internal_groupid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_groupid());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RequestVoteArgs::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProto.RequestVoteArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RequestVoteArgs* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RequestVoteArgs>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProto.RequestVoteArgs)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProto.RequestVoteArgs)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TimeoutNowArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TimeoutNowArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TimeoutNowArgs::GetClassData() const { return &_class_data_; }
 
-void RequestVoteArgs::MergeFrom(const RequestVoteArgs& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.RequestVoteArgs)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void TimeoutNowArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TimeoutNowArgs*>(&to_msg);
+  auto& from = static_cast<const TimeoutNowArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.TimeoutNowArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
-  }
-  if (from.candidateid() != 0) {
-    _internal_set_candidateid(from._internal_candidateid());
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
   }
-  if (from.lastlogindex() != 0) {
-    _internal_set_lastlogindex(from._internal_lastlogindex());
+  if (from._internal_leaderid() != 0) {
+    _this->_internal_set_leaderid(from._internal_leaderid());
   }
-  if (from.lastlogterm() != 0) {
-    _internal_set_lastlogterm(from._internal_lastlogterm());
+  if (from._internal_groupid() != 0) {
+    _this->_internal_set_groupid(from._internal_groupid());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RequestVoteArgs::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProto.RequestVoteArgs)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void RequestVoteArgs::CopyFrom(const RequestVoteArgs& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.RequestVoteArgs)
+void TimeoutNowArgs::CopyFrom(const TimeoutNowArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.TimeoutNowArgs)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RequestVoteArgs::IsInitialized() const {
+bool TimeoutNowArgs::IsInitialized() const {
   return true;
 }
 
-void RequestVoteArgs::InternalSwap(RequestVoteArgs* other) {
+void TimeoutNowArgs::InternalSwap(TimeoutNowArgs* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RequestVoteArgs, lastlogterm_)
-      + sizeof(RequestVoteArgs::lastlogterm_)
-      - PROTOBUF_FIELD_OFFSET(RequestVoteArgs, term_)>(
-          reinterpret_cast<char*>(&term_),
-          reinterpret_cast<char*>(&other->term_));
+      PROTOBUF_FIELD_OFFSET(TimeoutNowArgs, _impl_.groupid_)
+      + sizeof(TimeoutNowArgs::_impl_.groupid_)
+      - PROTOBUF_FIELD_OFFSET(TimeoutNowArgs, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RequestVoteArgs::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata TimeoutNowArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[12]);
 }
 
-
 // ===================================================================
 
-void RequestVoteReply::InitAsDefaultInstance() {
-}
-class RequestVoteReply::_Internal {
+class TimeoutNowReply::_Internal {
  public:
 };
 
-RequestVoteReply::RequestVoteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProto.RequestVoteReply)
+TimeoutNowReply::TimeoutNowReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProto.TimeoutNowReply)
 }
-RequestVoteReply::RequestVoteReply(const RequestVoteReply& from)
+TimeoutNowReply::TimeoutNowReply(const TimeoutNowReply& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&term_, &from.term_,
-    static_cast<size_t>(reinterpret_cast<char*>(&votestate_) -
-    reinterpret_cast<char*>(&term_)) + sizeof(votestate_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProto.RequestVoteReply)
-}
-
-void RequestVoteReply::SharedCtor() {
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&votestate_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(votestate_));
-}
+  TimeoutNowReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-RequestVoteReply::~RequestVoteReply() {
-  // @@protoc_insertion_point(destructor:raftRpcProto.RequestVoteReply)
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.term_, &from._impl_.term_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.success_) -
+    reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.success_));
+  // @@protoc_insertion_point(copy_constructor:raftRpcProto.TimeoutNowReply)
+}
+
+inline void TimeoutNowReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.term_){0}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TimeoutNowReply::~TimeoutNowReply() {
+  // @@protoc_insertion_point(destructor:raftRpcProto.TimeoutNowReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void RequestVoteReply::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void TimeoutNowReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void RequestVoteReply::ArenaDtor(void* object) {
-  RequestVoteReply* _this = reinterpret_cast< RequestVoteReply* >(object);
-  (void)_this;
-}
-void RequestVoteReply::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void RequestVoteReply::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RequestVoteReply& RequestVoteReply::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RequestVoteReply_raftRPC_2eproto.base);
-  return *internal_default_instance();
+void TimeoutNowReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void RequestVoteReply::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProto.RequestVoteReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void TimeoutNowReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProto.TimeoutNowReply)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&term_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&votestate_) -
-      reinterpret_cast<char*>(&term_)) + sizeof(votestate_));
+  ::memset(&_impl_.term_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.success_) -
+      reinterpret_cast<char*>(&_impl_.term_)) + sizeof(_impl_.success_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RequestVoteReply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TimeoutNowReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 Term = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // bool VoteGranted = 2;
+      // bool Success = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          votegranted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // int32 VoteState = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          votestate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RequestVoteReply::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.RequestVoteReply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* TimeoutNowReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.TimeoutNowReply)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
+  if (this->_internal_term() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
   }
 
-  // bool VoteGranted = 2;
-  if (this->votegranted() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_votegranted(), target);
-  }
-
-  // int32 VoteState = 3;
-  if (this->votestate() != 0) {
+  // bool Success = 2;
+  if (this->_internal_success() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_votestate(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.RequestVoteReply)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.TimeoutNowReply)
   return target;
 }
 
-size_t RequestVoteReply::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.RequestVoteReply)
+size_t TimeoutNowReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.TimeoutNowReply)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // int32 Term = 1;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
+  if (this->_internal_term() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_term());
   }
 
-  // bool VoteGranted = 2;
-  if (this->votegranted() != 0) {
+  // bool Success = 2;
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  // int32 VoteState = 3;
-  if (this->votestate() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_votestate());
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RequestVoteReply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProto.RequestVoteReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RequestVoteReply* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RequestVoteReply>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProto.RequestVoteReply)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProto.RequestVoteReply)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TimeoutNowReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TimeoutNowReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TimeoutNowReply::GetClassData() const { return &_class_data_; }
 
-void RequestVoteReply::MergeFrom(const RequestVoteReply& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.RequestVoteReply)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void TimeoutNowReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TimeoutNowReply*>(&to_msg);
+  auto& from = static_cast<const TimeoutNowReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.TimeoutNowReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
-  }
-  if (from.votegranted() != 0) {
-    _internal_set_votegranted(from._internal_votegranted());
+  if (from._internal_term() != 0) {
+    _this->_internal_set_term(from._internal_term());
   }
-  if (from.votestate() != 0) {
-    _internal_set_votestate(from._internal_votestate());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RequestVoteReply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProto.RequestVoteReply)
+void TimeoutNowReply::CopyFrom(const TimeoutNowReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.TimeoutNowReply)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void RequestVoteReply::CopyFrom(const RequestVoteReply& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.RequestVoteReply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool RequestVoteReply::IsInitialized() const {
+bool TimeoutNowReply::IsInitialized() const {
   return true;
 }
 
-void RequestVoteReply::InternalSwap(RequestVoteReply* other) {
+void TimeoutNowReply::InternalSwap(TimeoutNowReply* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RequestVoteReply, votestate_)
-      + sizeof(RequestVoteReply::votestate_)
-      - PROTOBUF_FIELD_OFFSET(RequestVoteReply, term_)>(
-          reinterpret_cast<char*>(&term_),
-          reinterpret_cast<char*>(&other->term_));
+      PROTOBUF_FIELD_OFFSET(TimeoutNowReply, _impl_.success_)
+      + sizeof(TimeoutNowReply::_impl_.success_)
+      - PROTOBUF_FIELD_OFFSET(TimeoutNowReply, _impl_.term_)>(
+          reinterpret_cast<char*>(&_impl_.term_),
+          reinterpret_cast<char*>(&other->_impl_.term_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RequestVoteReply::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata TimeoutNowReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[13]);
 }
 
-
 // ===================================================================
 
-void InstallSnapshotRequest::InitAsDefaultInstance() {
-}
-class InstallSnapshotRequest::_Internal {
+class BatchAppendEntriesArgs::_Internal {
  public:
 };
 
-InstallSnapshotRequest::InstallSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProto.InstallSnapshotRequest)
+BatchAppendEntriesArgs::BatchAppendEntriesArgs(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProto.BatchAppendEntriesArgs)
 }
-InstallSnapshotRequest::InstallSnapshotRequest(const InstallSnapshotRequest& from)
+BatchAppendEntriesArgs::BatchAppendEntriesArgs(const BatchAppendEntriesArgs& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchAppendEntriesArgs* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.args_){from._impl_.args_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_data().empty()) {
-    data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_data(),
-      GetArena());
-  }
-  ::memcpy(&leaderid_, &from.leaderid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&lastsnapshotincludeterm_) -
-    reinterpret_cast<char*>(&leaderid_)) + sizeof(lastsnapshotincludeterm_));
-  // @@protoc_insertion_point(copy_constructor:raftRpcProto.InstallSnapshotRequest)
+  // @@protoc_insertion_point(copy_constructor:raftRpcProto.BatchAppendEntriesArgs)
 }
 
-void InstallSnapshotRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_InstallSnapshotRequest_raftRPC_2eproto.base);
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&leaderid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lastsnapshotincludeterm_) -
-      reinterpret_cast<char*>(&leaderid_)) + sizeof(lastsnapshotincludeterm_));
+inline void BatchAppendEntriesArgs::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.args_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-InstallSnapshotRequest::~InstallSnapshotRequest() {
-  // @@protoc_insertion_point(destructor:raftRpcProto.InstallSnapshotRequest)
+BatchAppendEntriesArgs::~BatchAppendEntriesArgs() {
+  // @@protoc_insertion_point(destructor:raftRpcProto.BatchAppendEntriesArgs)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void InstallSnapshotRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void BatchAppendEntriesArgs::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.args_.~RepeatedPtrField();
 }
 
-void InstallSnapshotRequest::ArenaDtor(void* object) {
-  InstallSnapshotRequest* _this = reinterpret_cast< InstallSnapshotRequest* >(object);
-  (void)_this;
-}
-void InstallSnapshotRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void InstallSnapshotRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const InstallSnapshotRequest& InstallSnapshotRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_InstallSnapshotRequest_raftRPC_2eproto.base);
-  return *internal_default_instance();
+void BatchAppendEntriesArgs::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void InstallSnapshotRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProto.InstallSnapshotRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void BatchAppendEntriesArgs::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProto.BatchAppendEntriesArgs)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  data_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::memset(&leaderid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lastsnapshotincludeterm_) -
-      reinterpret_cast<char*>(&leaderid_)) + sizeof(lastsnapshotincludeterm_));
+  _impl_.args_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* InstallSnapshotRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* BatchAppendEntriesArgs::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 LeaderId = 1;
+      // repeated .raftRpcProto.AppendEntriesArgs Args = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          leaderid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 Term = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 LastSnapShotIncludeIndex = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          lastsnapshotincludeindex_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 LastSnapShotIncludeTerm = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          lastsnapshotincludeterm_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_args(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      // bytes Data = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          auto str = _internal_mutable_data();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* InstallSnapshotRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.InstallSnapshotRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* BatchAppendEntriesArgs::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.BatchAppendEntriesArgs)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 LeaderId = 1;
-  if (this->leaderid() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_leaderid(), target);
-  }
-
-  // int32 Term = 2;
-  if (this->term() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_term(), target);
-  }
-
-  // int32 LastSnapShotIncludeIndex = 3;
-  if (this->lastsnapshotincludeindex() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_lastsnapshotincludeindex(), target);
-  }
-
-  // int32 LastSnapShotIncludeTerm = 4;
-  if (this->lastsnapshotincludeterm() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_lastsnapshotincludeterm(), target);
-  }
-
-  // bytes Data = 5;
-  if (this->data().size() > 0) {
-    target = stream->WriteBytesMaybeAliased(
-        5, this->_internal_data(), target);
+  // repeated .raftRpcProto.AppendEntriesArgs Args = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_args_size()); i < n; i++) {
+    const auto& repfield = this->_internal_args(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.InstallSnapshotRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.BatchAppendEntriesArgs)
   return target;
 }
 
-size_t InstallSnapshotRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.InstallSnapshotRequest)
+size_t BatchAppendEntriesArgs::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.BatchAppendEntriesArgs)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // bytes Data = 5;
-  if (this->data().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_data());
-  }
-
-  // int32 LeaderId = 1;
-  if (this->leaderid() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_leaderid());
-  }
-
-  // int32 Term = 2;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
-  }
-
-  // int32 LastSnapShotIncludeIndex = 3;
-  if (this->lastsnapshotincludeindex() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_lastsnapshotincludeindex());
-  }
-
-  // int32 LastSnapShotIncludeTerm = 4;
-  if (this->lastsnapshotincludeterm() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_lastsnapshotincludeterm());
+  // repeated .raftRpcProto.AppendEntriesArgs Args = 1;
+  total_size += 1UL * this->_internal_args_size();
+  for (const auto& msg : this->_impl_.args_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void InstallSnapshotRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProto.InstallSnapshotRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const InstallSnapshotRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<InstallSnapshotRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProto.InstallSnapshotRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProto.InstallSnapshotRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchAppendEntriesArgs::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchAppendEntriesArgs::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchAppendEntriesArgs::GetClassData() const { return &_class_data_; }
 
-void InstallSnapshotRequest::MergeFrom(const InstallSnapshotRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.InstallSnapshotRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.data().size() > 0) {
-    _internal_set_data(from._internal_data());
-  }
-  if (from.leaderid() != 0) {
-    _internal_set_leaderid(from._internal_leaderid());
-  }
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
-  }
-  if (from.lastsnapshotincludeindex() != 0) {
-    _internal_set_lastsnapshotincludeindex(from._internal_lastsnapshotincludeindex());
-  }
-  if (from.lastsnapshotincludeterm() != 0) {
-    _internal_set_lastsnapshotincludeterm(from._internal_lastsnapshotincludeterm());
-  }
-}
+void BatchAppendEntriesArgs::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchAppendEntriesArgs*>(&to_msg);
+  auto& from = static_cast<const BatchAppendEntriesArgs&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.BatchAppendEntriesArgs)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void InstallSnapshotRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProto.InstallSnapshotRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.args_.MergeFrom(from._impl_.args_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void InstallSnapshotRequest::CopyFrom(const InstallSnapshotRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.InstallSnapshotRequest)
+void BatchAppendEntriesArgs::CopyFrom(const BatchAppendEntriesArgs& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.BatchAppendEntriesArgs)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InstallSnapshotRequest::IsInitialized() const {
+bool BatchAppendEntriesArgs::IsInitialized() const {
   return true;
 }
 
-void InstallSnapshotRequest::InternalSwap(InstallSnapshotRequest* other) {
+void BatchAppendEntriesArgs::InternalSwap(BatchAppendEntriesArgs* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  data_.Swap(&other->data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(InstallSnapshotRequest, lastsnapshotincludeterm_)
-      + sizeof(InstallSnapshotRequest::lastsnapshotincludeterm_)
-      - PROTOBUF_FIELD_OFFSET(InstallSnapshotRequest, leaderid_)>(
-          reinterpret_cast<char*>(&leaderid_),
-          reinterpret_cast<char*>(&other->leaderid_));
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.args_.InternalSwap(&other->_impl_.args_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata InstallSnapshotRequest::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata BatchAppendEntriesArgs::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[14]);
 }
 
-
 // ===================================================================
 
-void InstallSnapshotResponse::InitAsDefaultInstance() {
-}
-class InstallSnapshotResponse::_Internal {
+class BatchAppendEntriesReply::_Internal {
  public:
 };
 
-InstallSnapshotResponse::InstallSnapshotResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:raftRpcProto.InstallSnapshotResponse)
+BatchAppendEntriesReply::BatchAppendEntriesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:raftRpcProto.BatchAppendEntriesReply)
 }
-InstallSnapshotResponse::InstallSnapshotResponse(const InstallSnapshotResponse& from)
+BatchAppendEntriesReply::BatchAppendEntriesReply(const BatchAppendEntriesReply& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchAppendEntriesReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.replies_){from._impl_.replies_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  term_ = from.term_;
-  // @@protoc_insertion_point(copy_constructor:raftRpcProto.InstallSnapshotResponse)
+  // @@protoc_insertion_point(copy_constructor:raftRpcProto.BatchAppendEntriesReply)
 }
 
-void InstallSnapshotResponse::SharedCtor() {
-  term_ = 0;
+inline void BatchAppendEntriesReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.replies_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-InstallSnapshotResponse::~InstallSnapshotResponse() {
-  // @@protoc_insertion_point(destructor:raftRpcProto.InstallSnapshotResponse)
+BatchAppendEntriesReply::~BatchAppendEntriesReply() {
+  // @@protoc_insertion_point(destructor:raftRpcProto.BatchAppendEntriesReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void InstallSnapshotResponse::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void BatchAppendEntriesReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.replies_.~RepeatedPtrField();
 }
 
-void InstallSnapshotResponse::ArenaDtor(void* object) {
-  InstallSnapshotResponse* _this = reinterpret_cast< InstallSnapshotResponse* >(object);
-  (void)_this;
-}
-void InstallSnapshotResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void InstallSnapshotResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const InstallSnapshotResponse& InstallSnapshotResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_InstallSnapshotResponse_raftRPC_2eproto.base);
-  return *internal_default_instance();
+void BatchAppendEntriesReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void InstallSnapshotResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:raftRpcProto.InstallSnapshotResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void BatchAppendEntriesReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:raftRpcProto.BatchAppendEntriesReply)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  term_ = 0;
+  _impl_.replies_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* InstallSnapshotResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* BatchAppendEntriesReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // int32 Term = 1;
+      // repeated .raftRpcProto.AppendEntriesReply Replies = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          term_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_replies(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* InstallSnapshotResponse::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.InstallSnapshotResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* BatchAppendEntriesReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:raftRpcProto.BatchAppendEntriesReply)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // int32 Term = 1;
-  if (this->term() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_term(), target);
+  // repeated .raftRpcProto.AppendEntriesReply Replies = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_replies_size()); i < n; i++) {
+    const auto& repfield = this->_internal_replies(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.InstallSnapshotResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:raftRpcProto.BatchAppendEntriesReply)
   return target;
 }
 
-size_t InstallSnapshotResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.InstallSnapshotResponse)
+size_t BatchAppendEntriesReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:raftRpcProto.BatchAppendEntriesReply)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // int32 Term = 1;
-  if (this->term() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_term());
+  // repeated .raftRpcProto.AppendEntriesReply Replies = 1;
+  total_size += 1UL * this->_internal_replies_size();
+  for (const auto& msg : this->_impl_.replies_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void InstallSnapshotResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:raftRpcProto.InstallSnapshotResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const InstallSnapshotResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<InstallSnapshotResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:raftRpcProto.InstallSnapshotResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:raftRpcProto.InstallSnapshotResponse)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchAppendEntriesReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchAppendEntriesReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchAppendEntriesReply::GetClassData() const { return &_class_data_; }
 
-void InstallSnapshotResponse::MergeFrom(const InstallSnapshotResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.InstallSnapshotResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.term() != 0) {
-    _internal_set_term(from._internal_term());
-  }
-}
+void BatchAppendEntriesReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchAppendEntriesReply*>(&to_msg);
+  auto& from = static_cast<const BatchAppendEntriesReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:raftRpcProto.BatchAppendEntriesReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void InstallSnapshotResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:raftRpcProto.InstallSnapshotResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.replies_.MergeFrom(from._impl_.replies_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void InstallSnapshotResponse::CopyFrom(const InstallSnapshotResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.InstallSnapshotResponse)
+void BatchAppendEntriesReply::CopyFrom(const BatchAppendEntriesReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:raftRpcProto.BatchAppendEntriesReply)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool InstallSnapshotResponse::IsInitialized() const {
+bool BatchAppendEntriesReply::IsInitialized() const {
   return true;
 }
 
-void InstallSnapshotResponse::InternalSwap(InstallSnapshotResponse* other) {
+void BatchAppendEntriesReply::InternalSwap(BatchAppendEntriesReply* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(term_, other->term_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.replies_.InternalSwap(&other->_impl_.replies_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata InstallSnapshotResponse::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata BatchAppendEntriesReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_raftRPC_2eproto_getter, &descriptor_table_raftRPC_2eproto_once,
+      file_level_metadata_raftRPC_2eproto[15]);
 }
 
-
 // ===================================================================
 
 raftRpc::~raftRpc() {}
@@ -2228,6 +4984,30 @@ void raftRpc::RequestVote(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
   done->Run();
 }
 
+void raftRpc::ReadIndex(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftRpcProto::ReadIndexArgs*,
+                         ::raftRpcProto::ReadIndexReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method ReadIndex() not implemented.");
+  done->Run();
+}
+
+void raftRpc::TimeoutNow(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftRpcProto::TimeoutNowArgs*,
+                         ::raftRpcProto::TimeoutNowReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method TimeoutNow() not implemented.");
+  done->Run();
+}
+
+void raftRpc::BatchAppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::raftRpcProto::BatchAppendEntriesArgs*,
+                         ::raftRpcProto::BatchAppendEntriesReply*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method BatchAppendEntries() not implemented.");
+  done->Run();
+}
+
 void raftRpc::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
                              ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
                              const ::PROTOBUF_NAMESPACE_ID::Message* request,
@@ -2259,6 +5039,30 @@ void raftRpc::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method
                  response),
              done);
       break;
+    case 3:
+      ReadIndex(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftRpcProto::ReadIndexArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftRpcProto::ReadIndexReply*>(
+                 response),
+             done);
+      break;
+    case 4:
+      TimeoutNow(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftRpcProto::TimeoutNowArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftRpcProto::TimeoutNowReply*>(
+                 response),
+             done);
+      break;
+    case 5:
+      BatchAppendEntries(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::raftRpcProto::BatchAppendEntriesArgs*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::raftRpcProto::BatchAppendEntriesReply*>(
+                 response),
+             done);
+      break;
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
       break;
@@ -2275,6 +5079,12 @@ const ::PROTOBUF_NAMESPACE_ID::Message& raftRpc::GetRequestPrototype(
       return ::raftRpcProto::InstallSnapshotRequest::default_instance();
     case 2:
       return ::raftRpcProto::RequestVoteArgs::default_instance();
+    case 3:
+      return ::raftRpcProto::ReadIndexArgs::default_instance();
+    case 4:
+      return ::raftRpcProto::TimeoutNowArgs::default_instance();
+    case 5:
+      return ::raftRpcProto::BatchAppendEntriesArgs::default_instance();
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
       return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
@@ -2292,6 +5102,12 @@ const ::PROTOBUF_NAMESPACE_ID::Message& raftRpc::GetResponsePrototype(
       return ::raftRpcProto::InstallSnapshotResponse::default_instance();
     case 2:
       return ::raftRpcProto::RequestVoteReply::default_instance();
+    case 3:
+      return ::raftRpcProto::ReadIndexReply::default_instance();
+    case 4:
+      return ::raftRpcProto::TimeoutNowReply::default_instance();
+    case 5:
+      return ::raftRpcProto::BatchAppendEntriesReply::default_instance();
     default:
       GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
       return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
@@ -2331,31 +5147,95 @@ void raftRpc_Stub::RequestVote(::PROTOBUF_NAMESPACE_ID::RpcController* controlle
   channel_->CallMethod(descriptor()->method(2),
                        controller, request, response, done);
 }
+void raftRpc_Stub::ReadIndex(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftRpcProto::ReadIndexArgs* request,
+                              ::raftRpcProto::ReadIndexReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(3),
+                       controller, request, response, done);
+}
+void raftRpc_Stub::TimeoutNow(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftRpcProto::TimeoutNowArgs* request,
+                              ::raftRpcProto::TimeoutNowReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(4),
+                       controller, request, response, done);
+}
+void raftRpc_Stub::BatchAppendEntries(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::raftRpcProto::BatchAppendEntriesArgs* request,
+                              ::raftRpcProto::BatchAppendEntriesReply* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(5),
+                       controller, request, response, done);
+}
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace raftRpcProto
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::raftRpcProto::LogEntry* Arena::CreateMaybeMessage< ::raftRpcProto::LogEntry >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProto::LogEntry*
+Arena::CreateMaybeMessage< ::raftRpcProto::LogEntry >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProto::LogEntry >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProto::AppendEntriesArgs* Arena::CreateMaybeMessage< ::raftRpcProto::AppendEntriesArgs >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProto::PeerAddr*
+Arena::CreateMaybeMessage< ::raftRpcProto::PeerAddr >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProto::PeerAddr >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProto::ConfChange*
+Arena::CreateMaybeMessage< ::raftRpcProto::ConfChange >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProto::ConfChange >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProto::ClusterConfig*
+Arena::CreateMaybeMessage< ::raftRpcProto::ClusterConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProto::ClusterConfig >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProto::AppendEntriesArgs*
+Arena::CreateMaybeMessage< ::raftRpcProto::AppendEntriesArgs >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProto::AppendEntriesArgs >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProto::AppendEntriesReply* Arena::CreateMaybeMessage< ::raftRpcProto::AppendEntriesReply >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProto::AppendEntriesReply*
+Arena::CreateMaybeMessage< ::raftRpcProto::AppendEntriesReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProto::AppendEntriesReply >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProto::RequestVoteArgs* Arena::CreateMaybeMessage< ::raftRpcProto::RequestVoteArgs >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProto::RequestVoteArgs*
+Arena::CreateMaybeMessage< ::raftRpcProto::RequestVoteArgs >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProto::RequestVoteArgs >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProto::RequestVoteReply* Arena::CreateMaybeMessage< ::raftRpcProto::RequestVoteReply >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProto::RequestVoteReply*
+Arena::CreateMaybeMessage< ::raftRpcProto::RequestVoteReply >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProto::RequestVoteReply >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProto::InstallSnapshotRequest* Arena::CreateMaybeMessage< ::raftRpcProto::InstallSnapshotRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProto::InstallSnapshotRequest*
+Arena::CreateMaybeMessage< ::raftRpcProto::InstallSnapshotRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProto::InstallSnapshotRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::raftRpcProto::InstallSnapshotResponse* Arena::CreateMaybeMessage< ::raftRpcProto::InstallSnapshotResponse >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::raftRpcProto::InstallSnapshotResponse*
+Arena::CreateMaybeMessage< ::raftRpcProto::InstallSnapshotResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::raftRpcProto::InstallSnapshotResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::raftRpcProto::ReadIndexArgs*
+Arena::CreateMaybeMessage< ::raftRpcProto::ReadIndexArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProto::ReadIndexArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProto::ReadIndexReply*
+Arena::CreateMaybeMessage< ::raftRpcProto::ReadIndexReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProto::ReadIndexReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProto::TimeoutNowArgs*
+Arena::CreateMaybeMessage< ::raftRpcProto::TimeoutNowArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProto::TimeoutNowArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProto::TimeoutNowReply*
+Arena::CreateMaybeMessage< ::raftRpcProto::TimeoutNowReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProto::TimeoutNowReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProto::BatchAppendEntriesArgs*
+Arena::CreateMaybeMessage< ::raftRpcProto::BatchAppendEntriesArgs >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProto::BatchAppendEntriesArgs >(arena);
+}
+template<> PROTOBUF_NOINLINE ::raftRpcProto::BatchAppendEntriesReply*
+Arena::CreateMaybeMessage< ::raftRpcProto::BatchAppendEntriesReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::raftRpcProto::BatchAppendEntriesReply >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)